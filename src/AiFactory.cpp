@@ -55,7 +55,35 @@ AiObjectContext* AiFactory::createAiObjectContext(Player* player, PlayerbotAI* b
     return new AiObjectContext(botAI);
 }
 
-uint8 AiFactory::GetPlayerSpecTab(Player* bot)
+std::unordered_map<uint32, AiFactory::CachedSpecTab> AiFactory::specTabs;
+std::shared_mutex AiFactory::specTabsLock;
+
+uint8 AiFactory::GetPlayerSpecTab(Player* player)
+{
+    uint32 const guid = player->GetGUID().GetCounter();
+    uint8 const level = player->GetLevel();
+    uint8 const activeSpec = player->GetActiveSpec();
+    {
+        std::shared_lock<std::shared_mutex> guard(specTabsLock);
+        auto itr = specTabs.find(guid);
+        if (itr != specTabs.end() && itr->second.level == level && itr->second.activeSpec == activeSpec)
+            return itr->second.tab;
+    }
+
+    uint8 const tab = CalculatePlayerSpecTab(player);
+
+    std::unique_lock<std::shared_mutex> guard(specTabsLock);
+    specTabs[guid] = {level, activeSpec, tab};
+    return tab;
+}
+
+void AiFactory::ResetPlayerSpecTab(Player* player)
+{
+    std::unique_lock<std::shared_mutex> guard(specTabsLock);
+    specTabs.erase(player->GetGUID().GetCounter());
+}
+
+uint8 AiFactory::CalculatePlayerSpecTab(Player* bot)
 {
     std::map<uint8, uint32> tabs = GetPlayerSpecTabs(bot);
 
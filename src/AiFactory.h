@@ -7,6 +7,8 @@
 #define _PLAYERBOT_AIFACTORY_H
 
 #include <map>
+#include <shared_mutex>
+#include <unordered_map>
 
 #include "Common.h"
 
@@ -28,10 +30,25 @@ public:
     static void AddDefaultDeadStrategies(Player* player, PlayerbotAI* const facade, Engine* deadEngine);
     static void AddDefaultCombatStrategies(Player* player, PlayerbotAI* const facade, Engine* engine);
 
+    // Cached per player until its talents, active spec or level change
     static uint8 GetPlayerSpecTab(Player* player);
+    static void ResetPlayerSpecTab(Player* player);
     static std::map<uint8, uint32> GetPlayerSpecTabs(Player* player);
     static BotRoles GetPlayerRoles(Player* player);
     static std::string GetPlayerSpecName(Player* player);
+
+private:
+    struct CachedSpecTab
+    {
+        uint8 level;
+        uint8 activeSpec;
+        uint8 tab;
+    };
+
+    static uint8 CalculatePlayerSpecTab(Player* player);
+
+    static std::unordered_map<uint32, CachedSpecTab> specTabs;
+    static std::shared_mutex specTabsLock;
 };
 
 #endif
@@ -57,18 +57,18 @@ bool BroadcastHelper::BroadcastTest(PlayerbotAI* ai, Player* bot)
 }
 
 /**
+@param composeMessage - builds the text, only called once a channel roll has passed
 @param toChannels - map of (ToChannel, chance), where chance is in range 0-100 as uint32 (unless global chance is not 100%)
 
 @return true if said to the channel, false otherwise
 */
-bool BroadcastHelper::BroadcastToChannelWithGlobalChance(PlayerbotAI* ai, std::string message, std::list<std::pair<ToChannel, uint32>> toChannels)
+bool BroadcastHelper::BroadcastToChannelWithGlobalChance(PlayerbotAI* ai, std::function<std::string()> const& composeMessage, std::list<std::pair<ToChannel, uint32>> toChannels)
 {
     if (!sPlayerbotAIConfig->enableBroadcasts)
         return false;
-    if (message.empty())
-    {
-        return false;
-    }
+
+    std::string message;
+    bool composed = false;
 
     for (const auto& pair : toChannels)
     {
@@ -76,91 +76,82 @@ bool BroadcastHelper::BroadcastToChannelWithGlobalChance(PlayerbotAI* ai, std::s
         uint32 chance = pair.second;
         uint32 broadcastRoll = urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue);
 
+        uint32 globalChance = 0;
         switch (pair.first)
         {
             case TO_GUILD:
-            {
-                if (roll <= chance
-                    && broadcastRoll <= sPlayerbotAIConfig->broadcastToGuildGlobalChance
-                    && ai->SayToGuild(message))
-                {
-                    return true;
-                }
+                globalChance = sPlayerbotAIConfig->broadcastToGuildGlobalChance;
                 break;
-            }
             case TO_WORLD:
-            {
-                if (roll <= chance
-                    && broadcastRoll <= sPlayerbotAIConfig->broadcastToWorldGlobalChance
-                    && ai->SayToWorld(message))
-                {
-                    return true;
-                }
+                globalChance = sPlayerbotAIConfig->broadcastToWorldGlobalChance;
                 break;
-            }
             case TO_GENERAL:
-            {
-                if (roll <= chance
-                    && broadcastRoll <= sPlayerbotAIConfig->broadcastToGeneralGlobalChance
-                    && ai->SayToChannel(message, ChatChannelId::GENERAL))
-                {
-                    return true;
-                }
+                globalChance = sPlayerbotAIConfig->broadcastToGeneralGlobalChance;
                 break;
-            }
             case TO_TRADE:
-            {
-                if (roll <= chance
-                    && broadcastRoll <= sPlayerbotAIConfig->broadcastToTradeGlobalChance
-                    && ai->SayToChannel(message, ChatChannelId::TRADE))
-                {
-                    return true;
-                }
+                globalChance = sPlayerbotAIConfig->broadcastToTradeGlobalChance;
                 break;
-            }
             case TO_LOOKING_FOR_GROUP:
-            {
-                if (roll <= chance
-                    && broadcastRoll <= sPlayerbotAIConfig->broadcastToLFGGlobalChance
-                    && ai->SayToChannel(message, ChatChannelId::LOOKING_FOR_GROUP))
-                {
-                    return true;
-                }
+                globalChance = sPlayerbotAIConfig->broadcastToLFGGlobalChance;
                 break;
-            }
             case TO_LOCAL_DEFENSE:
-            {
-                if (roll <= chance
-                    && broadcastRoll <= sPlayerbotAIConfig->broadcastToLocalDefenseGlobalChance
-                    && ai->SayToChannel(message, ChatChannelId::LOCAL_DEFENSE))
-                {
-                    return true;
-                }
+                globalChance = sPlayerbotAIConfig->broadcastToLocalDefenseGlobalChance;
                 break;
-            }
             case TO_WORLD_DEFENSE:
-            {
-                if (roll <= chance
-                    && broadcastRoll <= sPlayerbotAIConfig->broadcastToWorldDefenseGlobalChance
-                    && ai->SayToChannel(message, ChatChannelId::WORLD_DEFENSE))
-                {
-                    return true;
-                }
+                globalChance = sPlayerbotAIConfig->broadcastToWorldDefenseGlobalChance;
                 break;
-            }
             case TO_GUILD_RECRUITMENT:
-            {
-                if (roll <= chance
-                    && broadcastRoll <= sPlayerbotAIConfig->broadcastToGuildRecruitmentGlobalChance
-                    && ai->SayToChannel(message, ChatChannelId::GUILD_RECRUITMENT))
-                {
-                    return true;
-                }
+                globalChance = sPlayerbotAIConfig->broadcastToGuildRecruitmentGlobalChance;
+                break;
+            default:
+                continue;
+        }
+
+        if (roll > chance || broadcastRoll > globalChance)
+            continue;
+
+        if (!composed)
+        {
+            message = composeMessage();
+            composed = true;
+        }
+
+        if (message.empty())
+            return false;
+
+        bool said = false;
+        switch (pair.first)
+        {
+            case TO_GUILD:
+                said = ai->SayToGuild(message);
+                break;
+            case TO_WORLD:
+                said = ai->SayToWorld(message);
+                break;
+            case TO_GENERAL:
+                said = ai->SayToChannel(message, ChatChannelId::GENERAL);
+                break;
+            case TO_TRADE:
+                said = ai->SayToChannel(message, ChatChannelId::TRADE);
+                break;
+            case TO_LOOKING_FOR_GROUP:
+                said = ai->SayToChannel(message, ChatChannelId::LOOKING_FOR_GROUP);
+                break;
+            case TO_LOCAL_DEFENSE:
+                said = ai->SayToChannel(message, ChatChannelId::LOCAL_DEFENSE);
+                break;
+            case TO_WORLD_DEFENSE:
+                said = ai->SayToChannel(message, ChatChannelId::WORLD_DEFENSE);
+                break;
+            case TO_GUILD_RECRUITMENT:
+                said = ai->SayToChannel(message, ChatChannelId::GUILD_RECRUITMENT);
                 break;
-            }
             default:
                 break;
         }
+
+        if (said)
+            return true;
     }
 
     return false;
@@ -170,93 +161,64 @@ bool BroadcastHelper::BroadcastLootingItem(PlayerbotAI* ai, Player* bot, const I
 {
     if (!sPlayerbotAIConfig->enableBroadcasts)
         return false;
-    std::map<std::string, std::string> placeholders;
-    placeholders["%item_link"] = ai->GetChatHelper()->FormatItem(proto);
-    AreaTableEntry const* current_area = ai->GetCurrentArea();
-    AreaTableEntry const* current_zone = ai->GetCurrentZone();
-    placeholders["%area_name"] = current_area ? ai->GetLocalizedAreaName(current_area) : BOT_TEXT1("string_unknown_area");
-    placeholders["%zone_name"] = current_zone ? ai->GetLocalizedAreaName(current_zone) : BOT_TEXT1("string_unknown_area");
-    placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
-    placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
-    placeholders["%my_level"] = std::to_string(bot->GetLevel());
 
+    uint32 chance = 0;
+    std::string textName;
     switch (proto->Quality)
     {
         case ITEM_QUALITY_POOR:
-            if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceLootingItemPoor)
-            {
-                return BroadcastToChannelWithGlobalChance(
-                    ai,
-                    BOT_TEXT2("broadcast_looting_item_poor", placeholders),
-                    { {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
-                );
-            }
+            chance = sPlayerbotAIConfig->broadcastChanceLootingItemPoor;
+            textName = "broadcast_looting_item_poor";
             break;
         case ITEM_QUALITY_NORMAL:
-            if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceLootingItemNormal)
-            {
-                return BroadcastToChannelWithGlobalChance(
-                    ai,
-                    BOT_TEXT2("broadcast_looting_item_normal", placeholders),
-                    { {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
-                );
-            }
+            chance = sPlayerbotAIConfig->broadcastChanceLootingItemNormal;
+            textName = "broadcast_looting_item_normal";
             break;
         case ITEM_QUALITY_UNCOMMON:
-            if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceLootingItemUncommon)
-            {
-                return BroadcastToChannelWithGlobalChance(
-                    ai,
-                    BOT_TEXT2("broadcast_looting_item_uncommon", placeholders),
-                    { {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
-                );
-            }
+            chance = sPlayerbotAIConfig->broadcastChanceLootingItemUncommon;
+            textName = "broadcast_looting_item_uncommon";
             break;
         case ITEM_QUALITY_RARE:
-            if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceLootingItemRare)
-            {
-                return BroadcastToChannelWithGlobalChance(
-                    ai,
-                    BOT_TEXT2("broadcast_looting_item_rare", placeholders),
-                    { {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
-                );
-            }
+            chance = sPlayerbotAIConfig->broadcastChanceLootingItemRare;
+            textName = "broadcast_looting_item_rare";
             break;
         case ITEM_QUALITY_EPIC:
-            if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceLootingItemEpic)
-            {
-                return BroadcastToChannelWithGlobalChance(
-                    ai,
-                    BOT_TEXT2("broadcast_looting_item_epic", placeholders),
-                    { {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
-                );
-            }
+            chance = sPlayerbotAIConfig->broadcastChanceLootingItemEpic;
+            textName = "broadcast_looting_item_epic";
             break;
         case ITEM_QUALITY_LEGENDARY:
-            if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceLootingItemLegendary)
-            {
-                return BroadcastToChannelWithGlobalChance(
-                    ai,
-                    BOT_TEXT2("broadcast_looting_item_legendary", placeholders),
-                    { {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
-                );
-            }
+            chance = sPlayerbotAIConfig->broadcastChanceLootingItemLegendary;
+            textName = "broadcast_looting_item_legendary";
             break;
         case ITEM_QUALITY_ARTIFACT:
-            if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceLootingItemArtifact)
-            {
-                return BroadcastToChannelWithGlobalChance(
-                    ai,
-                    BOT_TEXT2("broadcast_looting_item_artifact", placeholders),
-                    { {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
-                );
-            }
+            chance = sPlayerbotAIConfig->broadcastChanceLootingItemArtifact;
+            textName = "broadcast_looting_item_artifact";
             break;
         default:
-            break;
+            return false;
     }
 
-    return false;
+    if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) > chance)
+        return false;
+
+    return BroadcastToChannelWithGlobalChance(
+        ai,
+        [&]()
+        {
+            std::map<std::string, std::string> placeholders;
+            placeholders["%item_link"] = ai->GetChatHelper()->FormatItem(proto);
+            AreaTableEntry const* current_area = ai->GetCurrentArea();
+            AreaTableEntry const* current_zone = ai->GetCurrentZone();
+            placeholders["%area_name"] = current_area ? ai->GetLocalizedAreaName(current_area) : BOT_TEXT1("string_unknown_area");
+            placeholders["%zone_name"] = current_zone ? ai->GetLocalizedAreaName(current_zone) : BOT_TEXT1("string_unknown_area");
+            placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
+            placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
+            placeholders["%my_level"] = std::to_string(bot->GetLevel());
+
+            return BOT_TEXT2(textName, placeholders);
+        },
+        { {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
+    );
 }
 
 bool BroadcastHelper::BroadcastQuestAccepted(PlayerbotAI* ai, Player* bot, const Quest* quest)
@@ -265,19 +227,22 @@ bool BroadcastHelper::BroadcastQuestAccepted(PlayerbotAI* ai, Player* bot, const
         return false;
     if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceQuestAccepted)
     {
-        std::map<std::string, std::string> placeholders;
-        placeholders["%quest_link"] = ai->GetChatHelper()->FormatQuest(quest);
-        AreaTableEntry const* current_area = ai->GetCurrentArea();
-        AreaTableEntry const* current_zone = ai->GetCurrentZone();
-        placeholders["%area_name"] = current_area ? ai->GetLocalizedAreaName(current_area) : BOT_TEXT1("string_unknown_area");
-        placeholders["%zone_name"] = current_zone ? ai->GetLocalizedAreaName(current_zone) : BOT_TEXT1("string_unknown_area");
-        placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
-        placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
-        placeholders["%my_level"] = std::to_string(bot->GetLevel());
-
         return BroadcastToChannelWithGlobalChance(
             ai,
-            BOT_TEXT2("broadcast_quest_accepted_generic", placeholders),
+            [&]()
+            {
+                std::map<std::string, std::string> placeholders;
+                placeholders["%quest_link"] = ai->GetChatHelper()->FormatQuest(quest);
+                AreaTableEntry const* current_area = ai->GetCurrentArea();
+                AreaTableEntry const* current_zone = ai->GetCurrentZone();
+                placeholders["%area_name"] = current_area ? ai->GetLocalizedAreaName(current_area) : BOT_TEXT1("string_unknown_area");
+                placeholders["%zone_name"] = current_zone ? ai->GetLocalizedAreaName(current_zone) : BOT_TEXT1("string_unknown_area");
+                placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
+                placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
+                placeholders["%my_level"] = std::to_string(bot->GetLevel());
+
+                return BOT_TEXT2("broadcast_quest_accepted_generic", placeholders);
+            },
             { {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
         );
     }
@@ -289,83 +254,89 @@ bool BroadcastHelper::BroadcastQuestUpdateAddKill(PlayerbotAI* ai, Player* bot,
 {
     if (!sPlayerbotAIConfig->enableBroadcasts)
         return false;
-    std::map<std::string, std::string> placeholders;
-    AreaTableEntry const* current_area = ai->GetCurrentArea();
-    AreaTableEntry const* current_zone = ai->GetCurrentZone();
-    placeholders["%area_name"] = current_area ? ai->GetLocalizedAreaName(current_area) : BOT_TEXT1("string_unknown_area");
-    placeholders["%zone_name"] = current_zone ? ai->GetLocalizedAreaName(current_zone) : BOT_TEXT1("string_unknown_area");
-    placeholders["%quest_link"] = ai->GetChatHelper()->FormatQuest(quest);
-    placeholders["%quest_obj_name"] = obectiveName;
-    placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
-    placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
-    placeholders["%my_level"] = std::to_string(bot->GetLevel());
-    placeholders["%quest_obj_available"] = std::to_string(availableCount);
-    placeholders["%quest_obj_required"] = std::to_string(requiredCount);
-    placeholders["%quest_obj_missing"] = std::to_string(requiredCount - std::min(availableCount, requiredCount));
-    placeholders["%quest_obj_full_formatted"] = ai->GetChatHelper()->FormatQuestObjective(obectiveName, availableCount, requiredCount);
 
+    std::string textName;
     if (availableCount < requiredCount
         && urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceQuestUpdateObjectiveProgress)
     {
-        return BroadcastToChannelWithGlobalChance(
-            ai,
-            BOT_TEXT2("broadcast_quest_update_add_kill_objective_progress", placeholders),
-            { {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
-        );
+        textName = "broadcast_quest_update_add_kill_objective_progress";
     }
     else if (availableCount == requiredCount
         && urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceQuestUpdateObjectiveCompleted)
     {
-        return BroadcastToChannelWithGlobalChance(
-            ai,
-            BOT_TEXT2("broadcast_quest_update_add_kill_objective_completed", placeholders),
-            { {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
-        );
+        textName = "broadcast_quest_update_add_kill_objective_completed";
     }
+    else
+        return false;
 
-    return false;
+    return BroadcastToChannelWithGlobalChance(
+        ai,
+        [&]()
+        {
+            std::map<std::string, std::string> placeholders;
+            AreaTableEntry const* current_area = ai->GetCurrentArea();
+            AreaTableEntry const* current_zone = ai->GetCurrentZone();
+            placeholders["%area_name"] = current_area ? ai->GetLocalizedAreaName(current_area) : BOT_TEXT1("string_unknown_area");
+            placeholders["%zone_name"] = current_zone ? ai->GetLocalizedAreaName(current_zone) : BOT_TEXT1("string_unknown_area");
+            placeholders["%quest_link"] = ai->GetChatHelper()->FormatQuest(quest);
+            placeholders["%quest_obj_name"] = obectiveName;
+            placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
+            placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
+            placeholders["%my_level"] = std::to_string(bot->GetLevel());
+            placeholders["%quest_obj_available"] = std::to_string(availableCount);
+            placeholders["%quest_obj_required"] = std::to_string(requiredCount);
+            placeholders["%quest_obj_missing"] = std::to_string(requiredCount - std::min(availableCount, requiredCount));
+            placeholders["%quest_obj_full_formatted"] = ai->GetChatHelper()->FormatQuestObjective(obectiveName, availableCount, requiredCount);
+
+            return BOT_TEXT2(textName, placeholders);
+        },
+        { {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
+    );
 }
 
 bool BroadcastHelper::BroadcastQuestUpdateAddItem(PlayerbotAI* ai, Player* bot, Quest const* quest, uint32 availableCount, uint32 requiredCount, const ItemTemplate* proto)
 {
     if (!sPlayerbotAIConfig->enableBroadcasts)
         return false;
-    std::map<std::string, std::string> placeholders;
-    AreaTableEntry const* current_area = ai->GetCurrentArea();
-    AreaTableEntry const* current_zone = ai->GetCurrentZone();
-    placeholders["%area_name"] = current_area ? ai->GetLocalizedAreaName(current_area) : BOT_TEXT1("string_unknown_area");
-    placeholders["%zone_name"] = current_zone ? ai->GetLocalizedAreaName(current_zone) : BOT_TEXT1("string_unknown_area");
-    placeholders["%quest_link"] = ai->GetChatHelper()->FormatQuest(quest);
-    std::string itemLinkFormatted = ai->GetChatHelper()->FormatItem(proto);
-    placeholders["%item_link"] = itemLinkFormatted;
-    placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
-    placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
-    placeholders["%my_level"] = std::to_string(bot->GetLevel());
-    placeholders["%quest_obj_available"] = std::to_string(availableCount);
-    placeholders["%quest_obj_required"] = std::to_string(requiredCount);
-    placeholders["%quest_obj_missing"] = std::to_string(requiredCount - std::min(availableCount, requiredCount));
-    placeholders["%quest_obj_full_formatted"] = ai->GetChatHelper()->FormatQuestObjective(itemLinkFormatted, availableCount, requiredCount);
 
+    std::string textName;
     if (availableCount < requiredCount
         && urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceQuestUpdateObjectiveProgress)
     {
-        return BroadcastToChannelWithGlobalChance(
-            ai,
-            BOT_TEXT2("broadcast_quest_update_add_item_objective_progress", placeholders),
-            { {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
-        );
+        textName = "broadcast_quest_update_add_item_objective_progress";
     }
     else if (availableCount == requiredCount
         && urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceQuestUpdateObjectiveCompleted)
     {
-        return BroadcastToChannelWithGlobalChance(
-            ai,
-            BOT_TEXT2("broadcast_quest_update_add_item_objective_completed", placeholders),
-            { {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
-        );
+        textName = "broadcast_quest_update_add_item_objective_completed";
     }
+    else
+        return false;
 
-    return false;
+    return BroadcastToChannelWithGlobalChance(
+        ai,
+        [&]()
+        {
+            std::map<std::string, std::string> placeholders;
+            AreaTableEntry const* current_area = ai->GetCurrentArea();
+            AreaTableEntry const* current_zone = ai->GetCurrentZone();
+            placeholders["%area_name"] = current_area ? ai->GetLocalizedAreaName(current_area) : BOT_TEXT1("string_unknown_area");
+            placeholders["%zone_name"] = current_zone ? ai->GetLocalizedAreaName(current_zone) : BOT_TEXT1("string_unknown_area");
+            placeholders["%quest_link"] = ai->GetChatHelper()->FormatQuest(quest);
+            std::string itemLinkFormatted = ai->GetChatHelper()->FormatItem(proto);
+            placeholders["%item_link"] = itemLinkFormatted;
+            placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
+            placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
+            placeholders["%my_level"] = std::to_string(bot->GetLevel());
+            placeholders["%quest_obj_available"] = std::to_string(availableCount);
+            placeholders["%quest_obj_required"] = std::to_string(requiredCount);
+            placeholders["%quest_obj_missing"] = std::to_string(requiredCount - std::min(availableCount, requiredCount));
+            placeholders["%quest_obj_full_formatted"] = ai->GetChatHelper()->FormatQuestObjective(itemLinkFormatted, availableCount, requiredCount);
+
+            return BOT_TEXT2(textName, placeholders);
+        },
+        { {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
+    );
 }
 
 bool BroadcastHelper::BroadcastQuestUpdateFailedTimer(PlayerbotAI* ai, Player* bot, Quest const* quest)
@@ -374,19 +345,22 @@ bool BroadcastHelper::BroadcastQuestUpdateFailedTimer(PlayerbotAI* ai, Player* b
         return false;
     if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceQuestUpdateFailedTimer)
     {
-        std::map<std::string, std::string> placeholders;
-        placeholders["%quest_link"] = ai->GetChatHelper()->FormatQuest(quest);
-        AreaTableEntry const* current_area = ai->GetCurrentArea();
-        AreaTableEntry const* current_zone = ai->GetCurrentZone();
-        placeholders["%area_name"] = current_area ? ai->GetLocalizedAreaName(current_area) : BOT_TEXT1("string_unknown_area");
-        placeholders["%zone_name"] = current_zone ? ai->GetLocalizedAreaName(current_zone) : BOT_TEXT1("string_unknown_area");
-        placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
-        placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
-        placeholders["%my_level"] = std::to_string(bot->GetLevel());
-
         return BroadcastToChannelWithGlobalChance(
             ai,
-            BOT_TEXT2("broadcast_quest_update_failed_timer", placeholders),
+            [&]()
+            {
+                std::map<std::string, std::string> placeholders;
+                placeholders["%quest_link"] = ai->GetChatHelper()->FormatQuest(quest);
+                AreaTableEntry const* current_area = ai->GetCurrentArea();
+                AreaTableEntry const* current_zone = ai->GetCurrentZone();
+                placeholders["%area_name"] = current_area ? ai->GetLocalizedAreaName(current_area) : BOT_TEXT1("string_unknown_area");
+                placeholders["%zone_name"] = current_zone ? ai->GetLocalizedAreaName(current_zone) : BOT_TEXT1("string_unknown_area");
+                placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
+                placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
+                placeholders["%my_level"] = std::to_string(bot->GetLevel());
+
+                return BOT_TEXT2("broadcast_quest_update_failed_timer", placeholders);
+            },
             { {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
         );
     }
@@ -400,20 +374,22 @@ bool BroadcastHelper::BroadcastQuestUpdateComplete(PlayerbotAI* ai, Player* bot,
         return false;
     if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceQuestUpdateComplete)
     {
-        std::map<std::string, std::string> placeholders;
-        placeholders["%quest_link"] = ai->GetChatHelper()->FormatQuest(quest);
-        AreaTableEntry const* current_area = ai->GetCurrentArea();
-        AreaTableEntry const* current_zone = ai->GetCurrentZone();
-        placeholders["%area_name"] = current_area ? ai->GetLocalizedAreaName(current_area) : BOT_TEXT1("string_unknown_area");
-        placeholders["%zone_name"] = current_zone ? ai->GetLocalizedAreaName(current_zone) : BOT_TEXT1("string_unknown_area");
-        placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
-        placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
-        placeholders["%my_level"] = std::to_string(bot->GetLevel());
-
-
         return BroadcastToChannelWithGlobalChance(
             ai,
-            BOT_TEXT2("broadcast_quest_update_complete", placeholders),
+            [&]()
+            {
+                std::map<std::string, std::string> placeholders;
+                placeholders["%quest_link"] = ai->GetChatHelper()->FormatQuest(quest);
+                AreaTableEntry const* current_area = ai->GetCurrentArea();
+                AreaTableEntry const* current_zone = ai->GetCurrentZone();
+                placeholders["%area_name"] = current_area ? ai->GetLocalizedAreaName(current_area) : BOT_TEXT1("string_unknown_area");
+                placeholders["%zone_name"] = current_zone ? ai->GetLocalizedAreaName(current_zone) : BOT_TEXT1("string_unknown_area");
+                placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
+                placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
+                placeholders["%my_level"] = std::to_string(bot->GetLevel());
+
+                return BOT_TEXT2("broadcast_quest_update_complete", placeholders);
+            },
             { {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
         );
     }
@@ -427,19 +403,22 @@ bool BroadcastHelper::BroadcastQuestTurnedIn(PlayerbotAI* ai, Player* bot, Quest
         return false;
     if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceQuestTurnedIn)
     {
-        std::map<std::string, std::string> placeholders;
-        placeholders["%quest_link"] = ai->GetChatHelper()->FormatQuest(quest);
-        AreaTableEntry const* current_area = ai->GetCurrentArea();
-        AreaTableEntry const* current_zone = ai->GetCurrentZone();
-        placeholders["%area_name"] = current_area ? ai->GetLocalizedAreaName(current_area) : BOT_TEXT1("string_unknown_area");
-        placeholders["%zone_name"] = current_zone ? ai->GetLocalizedAreaName(current_zone) : BOT_TEXT1("string_unknown_area");
-        placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
-        placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
-        placeholders["%my_level"] = std::to_string(bot->GetLevel());
-
         return BroadcastToChannelWithGlobalChance(
             ai,
-            BOT_TEXT2("broadcast_quest_turned_in", placeholders),
+            [&]()
+            {
+                std::map<std::string, std::string> placeholders;
+                placeholders["%quest_link"] = ai->GetChatHelper()->FormatQuest(quest);
+                AreaTableEntry const* current_area = ai->GetCurrentArea();
+                AreaTableEntry const* current_zone = ai->GetCurrentZone();
+                placeholders["%area_name"] = current_area ? ai->GetLocalizedAreaName(current_area) : BOT_TEXT1("string_unknown_area");
+                placeholders["%zone_name"] = current_zone ? ai->GetLocalizedAreaName(current_zone) : BOT_TEXT1("string_unknown_area");
+                placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
+                placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
+                placeholders["%my_level"] = std::to_string(bot->GetLevel());
+
+                return BOT_TEXT2("broadcast_quest_turned_in", placeholders);
+            },
             { {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
         );
     }
@@ -451,116 +430,84 @@ bool BroadcastHelper::BroadcastKill(PlayerbotAI* ai, Player* bot, Creature *crea
 {
     if (!sPlayerbotAIConfig->enableBroadcasts)
         return false;
-    std::map<std::string, std::string> placeholders;
-    placeholders["%victim_name"] = creature->GetName();
-    AreaTableEntry const* current_area = ai->GetCurrentArea();
-    AreaTableEntry const* current_zone = ai->GetCurrentZone();
-    placeholders["%area_name"] = current_area ? ai->GetLocalizedAreaName(current_area) : BOT_TEXT1("string_unknown_area");
-    placeholders["%zone_name"] = current_zone ? ai->GetLocalizedAreaName(current_zone) : BOT_TEXT1("string_unknown_area");
-    placeholders["%victim_level"] = creature->GetLevel();
-    placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
-    placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
-    placeholders["%my_level"] = std::to_string(bot->GetLevel());
 
     //if ((creature->IsElite() && !creature->GetMap()->IsDungeon())
     //if creature->IsWorldBoss()
     //if creature->GetLevel() > DEFAULT_MAX_LEVEL + 1
     //if creature->GetLevel() > bot->GetLevel() + 4
 
+    uint32 chance = 0;
+    std::string textName;
+    std::list<std::pair<ToChannel, uint32>> toChannels = { {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} };
+
     if (creature->IsPet())
     {
-        if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceKillPet)
-        {
-            return BroadcastToChannelWithGlobalChance(
-                ai,
-                BOT_TEXT2("broadcast_killed_pet", placeholders),
-                { {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
-            );
-        }
+        chance = sPlayerbotAIConfig->broadcastChanceKillPet;
+        textName = "broadcast_killed_pet";
     }
     else if (creature->IsPlayer())
     {
-        if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceKillPlayer)
-        {
-            placeholders["%victim_class"] = ai->GetChatHelper()->FormatClass(creature->getClass());
-
-            return BroadcastToChannelWithGlobalChance(
-                ai,
-                BOT_TEXT2("broadcast_killed_player", placeholders),
-                { {TO_WORLD_DEFENSE, 50}, {TO_LOCAL_DEFENSE, 50}, {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
-            );
-        }
+        chance = sPlayerbotAIConfig->broadcastChanceKillPlayer;
+        textName = "broadcast_killed_player";
+        toChannels = { {TO_WORLD_DEFENSE, 50}, {TO_LOCAL_DEFENSE, 50}, {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} };
     }
     else
     {
         switch (creature->GetCreatureTemplate()->rank)
         {
             case CREATURE_ELITE_NORMAL:
-                if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceKillNormal)
-                {
-                    return BroadcastToChannelWithGlobalChance(
-                        ai,
-                        BOT_TEXT2("broadcast_killed_normal", placeholders),
-                        { {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
-                    );
-                }
+                chance = sPlayerbotAIConfig->broadcastChanceKillNormal;
+                textName = "broadcast_killed_normal";
                 break;
             case CREATURE_ELITE_ELITE:
-                if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceKillElite)
-                {
-                    return BroadcastToChannelWithGlobalChance(
-                        ai,
-                        BOT_TEXT2("broadcast_killed_elite", placeholders),
-                        { {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
-                    );
-                }
+                chance = sPlayerbotAIConfig->broadcastChanceKillElite;
+                textName = "broadcast_killed_elite";
                 break;
             case CREATURE_ELITE_RAREELITE:
-                if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceKillRareelite)
-                {
-                    return BroadcastToChannelWithGlobalChance(
-                        ai,
-                        BOT_TEXT2("broadcast_killed_rareelite", placeholders),
-                        { {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
-                    );
-                }
+                chance = sPlayerbotAIConfig->broadcastChanceKillRareelite;
+                textName = "broadcast_killed_rareelite";
                 break;
             case CREATURE_ELITE_WORLDBOSS:
-                if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceKillWorldboss)
-                {
-                    return BroadcastToChannelWithGlobalChance(
-                        ai,
-                        BOT_TEXT2("broadcast_killed_worldboss", placeholders),
-                        { {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
-                    );
-                }
+                chance = sPlayerbotAIConfig->broadcastChanceKillWorldboss;
+                textName = "broadcast_killed_worldboss";
                 break;
             case CREATURE_ELITE_RARE:
-                if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceKillRare)
-                {
-                    return BroadcastToChannelWithGlobalChance(
-                        ai,
-                        BOT_TEXT2("broadcast_killed_rare", placeholders),
-                        { {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
-                    );
-                }
+                chance = sPlayerbotAIConfig->broadcastChanceKillRare;
+                textName = "broadcast_killed_rare";
                 break;
             case CREATURE_UNKNOWN:
-                if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceKillUnknown)
-                {
-                    return BroadcastToChannelWithGlobalChance(
-                        ai,
-                        BOT_TEXT2("broadcast_killed_unknown", placeholders),
-                        { {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
-                    );
-                }
+                chance = sPlayerbotAIConfig->broadcastChanceKillUnknown;
+                textName = "broadcast_killed_unknown";
                 break;
             default:
-                break;
+                return false;
         }
     }
 
-    return false;
+    if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) > chance)
+        return false;
+
+    return BroadcastToChannelWithGlobalChance(
+        ai,
+        [&]()
+        {
+            std::map<std::string, std::string> placeholders;
+            placeholders["%victim_name"] = creature->GetName();
+            AreaTableEntry const* current_area = ai->GetCurrentArea();
+            AreaTableEntry const* current_zone = ai->GetCurrentZone();
+            placeholders["%area_name"] = current_area ? ai->GetLocalizedAreaName(current_area) : BOT_TEXT1("string_unknown_area");
+            placeholders["%zone_name"] = current_zone ? ai->GetLocalizedAreaName(current_zone) : BOT_TEXT1("string_unknown_area");
+            placeholders["%victim_level"] = creature->GetLevel();
+            placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
+            placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
+            placeholders["%my_level"] = std::to_string(bot->GetLevel());
+            if (creature->IsPlayer())
+                placeholders["%victim_class"] = ai->GetChatHelper()->FormatClass(creature->getClass());
+
+            return BOT_TEXT2(textName, placeholders);
+        },
+        toChannels
+    );
 }
 
 bool BroadcastHelper::BroadcastLevelup(PlayerbotAI* ai, Player* bot)
@@ -569,44 +516,46 @@ bool BroadcastHelper::BroadcastLevelup(PlayerbotAI* ai, Player* bot)
         return false;
     uint32 level = bot->GetLevel();
 
-    std::map<std::string, std::string> placeholders;
-    AreaTableEntry const* current_area = ai->GetCurrentArea();
-    AreaTableEntry const* current_zone = ai->GetCurrentZone();
-    placeholders["%area_name"] = current_area ? ai->GetLocalizedAreaName(current_area) : BOT_TEXT1("string_unknown_area");
-    placeholders["%zone_name"] = current_zone ? ai->GetLocalizedAreaName(current_zone) : BOT_TEXT1("string_unknown_area");
-    placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
-    placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
-    placeholders["%my_level"] = std::to_string(level);
-
+    std::string textName;
+    std::list<std::pair<ToChannel, uint32>> toChannels;
     if (level == sPlayerbotAIConfig->randomBotMaxLevel
         && urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceLevelupMaxLevel)
     {
-        return BroadcastToChannelWithGlobalChance(
-            ai,
-            BOT_TEXT2("broadcast_levelup_max_level", placeholders),
-            { {TO_GUILD, 30}, {TO_WORLD, 90}, {TO_GENERAL, 100} }
-        );
+        textName = "broadcast_levelup_max_level";
+        toChannels = { {TO_GUILD, 30}, {TO_WORLD, 90}, {TO_GENERAL, 100} };
     }
     // It's divisible by 10
     else if (level % 10 == 0
         && urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceLevelupTenX)
     {
-        return BroadcastToChannelWithGlobalChance(
-            ai,
-            BOT_TEXT2("broadcast_levelup_10x", placeholders),
-            { {TO_GUILD, 50}, {TO_WORLD, 90}, {TO_GENERAL, 100} }
-        );
+        textName = "broadcast_levelup_10x";
+        toChannels = { {TO_GUILD, 50}, {TO_WORLD, 90}, {TO_GENERAL, 100} };
     }
     else if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceLevelupGeneric)
     {
-        return BroadcastToChannelWithGlobalChance(
-            ai,
-            BOT_TEXT2("broadcast_levelup_generic", placeholders),
-            { {TO_GUILD, 90}, {TO_WORLD, 90}, {TO_GENERAL, 100} }
-        );
+        textName = "broadcast_levelup_generic";
+        toChannels = { {TO_GUILD, 90}, {TO_WORLD, 90}, {TO_GENERAL, 100} };
     }
+    else
+        return false;
 
-    return false;
+    return BroadcastToChannelWithGlobalChance(
+        ai,
+        [&]()
+        {
+            std::map<std::string, std::string> placeholders;
+            AreaTableEntry const* current_area = ai->GetCurrentArea();
+            AreaTableEntry const* current_zone = ai->GetCurrentZone();
+            placeholders["%area_name"] = current_area ? ai->GetLocalizedAreaName(current_area) : BOT_TEXT1("string_unknown_area");
+            placeholders["%zone_name"] = current_zone ? ai->GetLocalizedAreaName(current_zone) : BOT_TEXT1("string_unknown_area");
+            placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
+            placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
+            placeholders["%my_level"] = std::to_string(level);
+
+            return BOT_TEXT2(textName, placeholders);
+        },
+        toChannels
+    );
 }
 
 bool BroadcastHelper::BroadcastGuildMemberPromotion(PlayerbotAI* ai, Player* bot, Player* player)
@@ -688,21 +637,24 @@ bool BroadcastHelper::BroadcastSuggestInstance(PlayerbotAI* ai, std::vector<std:
         return false;
     if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceSuggestInstance)
     {
-        std::map<std::string, std::string> placeholders;
-        placeholders["%my_role"] = ChatHelper::FormatClass(bot, AiFactory::GetPlayerSpecTab(bot));
+        return BroadcastToChannelWithGlobalChance(
+            ai,
+            [&]()
+            {
+                std::map<std::string, std::string> placeholders;
+                placeholders["%my_role"] = ChatHelper::FormatClass(bot, AiFactory::GetPlayerSpecTab(bot));
 
-        std::ostringstream itemout;
-        //itemout << "|c00b000b0" << allowedInstances[urand(0, allowedInstances.size() - 1)] << "|r";
-        itemout << allowedInstances[urand(0, allowedInstances.size() - 1)];
-        placeholders["%instance_name"] = itemout.str();
+                std::ostringstream itemout;
+                //itemout << "|c00b000b0" << allowedInstances[urand(0, allowedInstances.size() - 1)] << "|r";
+                itemout << allowedInstances[urand(0, allowedInstances.size() - 1)];
+                placeholders["%instance_name"] = itemout.str();
 
-        placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
-        placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
-        placeholders["%my_level"] = std::to_string(bot->GetLevel());
+                placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
+                placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
+                placeholders["%my_level"] = std::to_string(bot->GetLevel());
 
-        return BroadcastToChannelWithGlobalChance(
-            ai,
-            BOT_TEXT2("suggest_instance", placeholders),
+                return BOT_TEXT2("suggest_instance", placeholders);
+            },
             { {TO_LOOKING_FOR_GROUP, 50}, {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
         );
     }
@@ -716,22 +668,24 @@ bool BroadcastHelper::BroadcastSuggestQuest(PlayerbotAI* ai, std::vector<uint32>
         return false;
     if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceSuggestQuest)
     {
+        return BroadcastToChannelWithGlobalChance(
+            ai,
+            [&]()
+            {
+                int index = rand() % quests.size();
 
-        int index = rand() % quests.size();
-
-        Quest const* quest = sObjectMgr->GetQuestTemplate(quests[index]);
+                Quest const* quest = sObjectMgr->GetQuestTemplate(quests[index]);
 
-        std::map<std::string, std::string> placeholders;
-        placeholders["%my_role"] = ChatHelper::FormatClass(bot, AiFactory::GetPlayerSpecTab(bot));
-        placeholders["%quest_link"] = ai->GetChatHelper()->FormatQuest(quest);
-        placeholders["%quest_level"] = std::to_string(quest->GetQuestLevel());
-        placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
-        placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
-        placeholders["%my_level"] = std::to_string(bot->GetLevel());
+                std::map<std::string, std::string> placeholders;
+                placeholders["%my_role"] = ChatHelper::FormatClass(bot, AiFactory::GetPlayerSpecTab(bot));
+                placeholders["%quest_link"] = ai->GetChatHelper()->FormatQuest(quest);
+                placeholders["%quest_level"] = std::to_string(quest->GetQuestLevel());
+                placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
+                placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
+                placeholders["%my_level"] = std::to_string(bot->GetLevel());
 
-        return BroadcastToChannelWithGlobalChance(
-            ai,
-            BOT_TEXT2("suggest_quest", placeholders),
+                return BOT_TEXT2("suggest_quest", placeholders);
+            },
             { {TO_LOOKING_FOR_GROUP, 50}, {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
         );
     }
@@ -745,18 +699,20 @@ bool BroadcastHelper::BroadcastSuggestGrindMaterials(PlayerbotAI* ai, std::strin
         return false;
     if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceSuggestGrindMaterials)
     {
-
-        std::map<std::string, std::string> placeholders;
-        placeholders["%my_role"] = ChatHelper::FormatClass(bot, AiFactory::GetPlayerSpecTab(bot));
-        placeholders["%category"] = item;
-
-        placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
-        placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
-        placeholders["%my_level"] = std::to_string(bot->GetLevel());
-
         return BroadcastToChannelWithGlobalChance(
             ai,
-            BOT_TEXT2("suggest_trade", placeholders),
+            [&]()
+            {
+                std::map<std::string, std::string> placeholders;
+                placeholders["%my_role"] = ChatHelper::FormatClass(bot, AiFactory::GetPlayerSpecTab(bot));
+                placeholders["%category"] = item;
+
+                placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
+                placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
+                placeholders["%my_level"] = std::to_string(bot->GetLevel());
+
+                return BOT_TEXT2("suggest_trade", placeholders);
+            },
             { {TO_TRADE, 50}, {TO_LOOKING_FOR_GROUP, 50}, {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
         );
     }
@@ -770,25 +726,27 @@ bool BroadcastHelper::BroadcastSuggestGrindReputation(PlayerbotAI* ai, std::vect
         return false;
     if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceSuggestGrindReputation)
     {
-
-        std::map<std::string, std::string> placeholders;
-        placeholders["%my_role"] = ChatHelper::FormatClass(bot, AiFactory::GetPlayerSpecTab(bot));
-        placeholders["%rep_level"] = levels[urand(0, 2)];
-        std::ostringstream rnd; rnd << urand(1, 5) << "K";
-        placeholders["%rndK"] = rnd.str();
-
-        std::ostringstream itemout;
-        //itemout << "|c004040b0" << allowedFactions[urand(0, allowedFactions.size() - 1)] << "|r";
-        itemout << allowedFactions[urand(0, allowedFactions.size() - 1)];
-        placeholders["%faction"] = itemout.str();
-
-        placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
-        placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
-        placeholders["%my_level"] = std::to_string(bot->GetLevel());
-
         return BroadcastToChannelWithGlobalChance(
             ai,
-            BOT_TEXT2("suggest_faction", placeholders),
+            [&]()
+            {
+                std::map<std::string, std::string> placeholders;
+                placeholders["%my_role"] = ChatHelper::FormatClass(bot, AiFactory::GetPlayerSpecTab(bot));
+                placeholders["%rep_level"] = levels[urand(0, 2)];
+                std::ostringstream rnd; rnd << urand(1, 5) << "K";
+                placeholders["%rndK"] = rnd.str();
+
+                std::ostringstream itemout;
+                //itemout << "|c004040b0" << allowedFactions[urand(0, allowedFactions.size() - 1)] << "|r";
+                itemout << allowedFactions[urand(0, allowedFactions.size() - 1)];
+                placeholders["%faction"] = itemout.str();
+
+                placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
+                placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
+                placeholders["%my_level"] = std::to_string(bot->GetLevel());
+
+                return BOT_TEXT2("suggest_faction", placeholders);
+            },
             { {TO_LOOKING_FOR_GROUP, 50}, {TO_GUILD, 50}, {TO_WORLD, 50}, {TO_GENERAL, 100} }
         );
     }
@@ -802,20 +760,22 @@ bool BroadcastHelper::BroadcastSuggestSell(PlayerbotAI* ai, const ItemTemplate*
         return false;
     if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceSuggestSell)
     {
-
-        std::map<std::string, std::string> placeholders;
-        placeholders["%item_link"] = ai->GetChatHelper()->FormatItem(proto, 0);
-        placeholders["%item_formatted_link"] = ai->GetChatHelper()->FormatItem(proto, count);
-        placeholders["%item_count"] = std::to_string(count);
-        placeholders["%cost_gold"] = ai->GetChatHelper()->formatMoney(price);
-
-        placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
-        placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
-        placeholders["%my_level"] = std::to_string(bot->GetLevel());
-
         return BroadcastToChannelWithGlobalChance(
             ai,
-            BOT_TEXT2("suggest_sell", placeholders),
+            [&]()
+            {
+                std::map<std::string, std::string> placeholders;
+                placeholders["%item_link"] = ai->GetChatHelper()->FormatItem(proto, 0);
+                placeholders["%item_formatted_link"] = ai->GetChatHelper()->FormatItem(proto, count);
+                placeholders["%item_count"] = std::to_string(count);
+                placeholders["%cost_gold"] = ai->GetChatHelper()->formatMoney(price);
+
+                placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
+                placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
+                placeholders["%my_level"] = std::to_string(bot->GetLevel());
+
+                return BOT_TEXT2("suggest_sell", placeholders);
+            },
             { {TO_TRADE, 90}, {TO_GENERAL, 100} }
         );
     }
@@ -829,20 +789,23 @@ bool BroadcastHelper::BroadcastSuggestSomething(PlayerbotAI* ai, Player* bot)
         return false;
     if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceSuggestSomething)
     {
-        std::map<std::string, std::string> placeholders;
-        placeholders["%my_role"] = ChatHelper::FormatClass(bot, AiFactory::GetPlayerSpecTab(bot));
-
-        AreaTableEntry const* current_area = ai->GetCurrentArea();
-        AreaTableEntry const* current_zone = ai->GetCurrentZone();
-        placeholders["%area_name"] = current_area ? ai->GetLocalizedAreaName(current_area) : BOT_TEXT1("string_unknown_area");
-        placeholders["%zone_name"] = current_zone ? ai->GetLocalizedAreaName(current_zone) : BOT_TEXT1("string_unknown_area");
-        placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
-        placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
-        placeholders["%my_level"] = std::to_string(bot->GetLevel());
-
         return BroadcastToChannelWithGlobalChance(
             ai,
-            BOT_TEXT2("suggest_something", placeholders),
+            [&]()
+            {
+                std::map<std::string, std::string> placeholders;
+                placeholders["%my_role"] = ChatHelper::FormatClass(bot, AiFactory::GetPlayerSpecTab(bot));
+
+                AreaTableEntry const* current_area = ai->GetCurrentArea();
+                AreaTableEntry const* current_zone = ai->GetCurrentZone();
+                placeholders["%area_name"] = current_area ? ai->GetLocalizedAreaName(current_area) : BOT_TEXT1("string_unknown_area");
+                placeholders["%zone_name"] = current_zone ? ai->GetLocalizedAreaName(current_zone) : BOT_TEXT1("string_unknown_area");
+                placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
+                placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
+                placeholders["%my_level"] = std::to_string(bot->GetLevel());
+
+                return BOT_TEXT2("suggest_something", placeholders);
+            },
             { {TO_GUILD, 10}, {TO_WORLD, 70}, {TO_GENERAL, 100} }
         );
     }
@@ -856,25 +819,28 @@ bool BroadcastHelper::BroadcastSuggestSomethingToxic(PlayerbotAI* ai, Player* bo
         return false;
     if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceSuggestSomethingToxic)
     {
-        //items
-        std::vector<Item*> botItems = ai->GetInventoryAndEquippedItems();
+        return BroadcastToChannelWithGlobalChance(
+            ai,
+            [&]()
+            {
+                //items
+                std::vector<Item*> botItems = ai->GetInventoryAndEquippedItems();
 
-        std::map<std::string, std::string> placeholders;
+                std::map<std::string, std::string> placeholders;
 
-        placeholders["%random_inventory_item_link"] = botItems.size() > 0 ? ai->GetChatHelper()->FormatItem(botItems[rand() % botItems.size()]->GetTemplate()) : BOT_TEXT1("string_empty_link");
+                placeholders["%random_inventory_item_link"] = botItems.size() > 0 ? ai->GetChatHelper()->FormatItem(botItems[rand() % botItems.size()]->GetTemplate()) : BOT_TEXT1("string_empty_link");
 
-        placeholders["%my_role"] = ChatHelper::FormatClass(bot, AiFactory::GetPlayerSpecTab(bot));
-        AreaTableEntry const* current_area = ai->GetCurrentArea();
-        AreaTableEntry const* current_zone = ai->GetCurrentZone();
-        placeholders["%area_name"] = current_area ? ai->GetLocalizedAreaName(current_area) : BOT_TEXT1("string_unknown_area");
-        placeholders["%zone_name"] = current_zone ? ai->GetLocalizedAreaName(current_zone) : BOT_TEXT1("string_unknown_area");
-        placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
-        placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
-        placeholders["%my_level"] = std::to_string(bot->GetLevel());
+                placeholders["%my_role"] = ChatHelper::FormatClass(bot, AiFactory::GetPlayerSpecTab(bot));
+                AreaTableEntry const* current_area = ai->GetCurrentArea();
+                AreaTableEntry const* current_zone = ai->GetCurrentZone();
+                placeholders["%area_name"] = current_area ? ai->GetLocalizedAreaName(current_area) : BOT_TEXT1("string_unknown_area");
+                placeholders["%zone_name"] = current_zone ? ai->GetLocalizedAreaName(current_zone) : BOT_TEXT1("string_unknown_area");
+                placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
+                placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
+                placeholders["%my_level"] = std::to_string(bot->GetLevel());
 
-        return BroadcastToChannelWithGlobalChance(
-            ai,
-            BOT_TEXT2("suggest_something_toxic", placeholders),
+                return BOT_TEXT2("suggest_something_toxic", placeholders);
+            },
             { {TO_GUILD, 10}, {TO_WORLD, 70}, {TO_GENERAL, 100} }
         );
     }
@@ -888,52 +854,55 @@ bool BroadcastHelper::BroadcastSuggestToxicLinks(PlayerbotAI* ai, Player* bot)
         return false;
     if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceSuggestToxicLinks)
     {
-        //quests
-        std::vector<uint32> incompleteQuests;
-        for (uint16 slot = 0; slot < MAX_QUEST_LOG_SIZE; ++slot)
-        {
-            uint32 questId = bot->GetQuestSlotQuestId(slot);
-            if (!questId)
-                continue;
+        return BroadcastToChannelWithGlobalChance(
+            ai,
+            [&]()
+            {
+                //quests
+                std::vector<uint32> incompleteQuests;
+                for (uint16 slot = 0; slot < MAX_QUEST_LOG_SIZE; ++slot)
+                {
+                    uint32 questId = bot->GetQuestSlotQuestId(slot);
+                    if (!questId)
+                        continue;
 
-            QuestStatus status = bot->GetQuestStatus(questId);
-            if (status == QUEST_STATUS_INCOMPLETE || status == QUEST_STATUS_NONE)
-                incompleteQuests.push_back(questId);
-        }
+                    QuestStatus status = bot->GetQuestStatus(questId);
+                    if (status == QUEST_STATUS_INCOMPLETE || status == QUEST_STATUS_NONE)
+                        incompleteQuests.push_back(questId);
+                }
 
-        //items
-        std::vector<Item*> botItems = ai->GetInventoryAndEquippedItems();
+                //items
+                std::vector<Item*> botItems = ai->GetInventoryAndEquippedItems();
 
-        //spells
-        //?
+                //spells
+                //?
 
-        std::map<std::string, std::string> placeholders;
+                std::map<std::string, std::string> placeholders;
 
-        placeholders["%random_inventory_item_link"] = botItems.size() > 0 ? ai->GetChatHelper()->FormatItem(botItems[rand() % botItems.size()]->GetTemplate()) : BOT_TEXT1("string_empty_link");
-        placeholders["%prefix"] = sPlayerbotAIConfig->toxicLinksPrefix;
+                placeholders["%random_inventory_item_link"] = botItems.size() > 0 ? ai->GetChatHelper()->FormatItem(botItems[rand() % botItems.size()]->GetTemplate()) : BOT_TEXT1("string_empty_link");
+                placeholders["%prefix"] = sPlayerbotAIConfig->toxicLinksPrefix;
 
-        if (incompleteQuests.size() > 0)
-        {
-            Quest const* quest = sObjectMgr->GetQuestTemplate(incompleteQuests[rand() % incompleteQuests.size()]);
-            placeholders["%random_taken_quest_or_item_link"] = ai->GetChatHelper()->FormatQuest(quest);
-        }
-        else
-        {
-            placeholders["%random_taken_quest_or_item_link"] = placeholders["%random_inventory_item_link"];
-        }
-
-        placeholders["%my_role"] = ChatHelper::FormatClass(bot, AiFactory::GetPlayerSpecTab(bot));
-        AreaTableEntry const* current_area = ai->GetCurrentArea();
-        AreaTableEntry const* current_zone = ai->GetCurrentZone();
-        placeholders["%area_name"] = current_area ? ai->GetLocalizedAreaName(current_area) : BOT_TEXT1("string_unknown_area");
-        placeholders["%zone_name"] = current_zone ? ai->GetLocalizedAreaName(current_zone) : BOT_TEXT1("string_unknown_area");
-        placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
-        placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
-        placeholders["%my_level"] = std::to_string(bot->GetLevel());
+                if (incompleteQuests.size() > 0)
+                {
+                    Quest const* quest = sObjectMgr->GetQuestTemplate(incompleteQuests[rand() % incompleteQuests.size()]);
+                    placeholders["%random_taken_quest_or_item_link"] = ai->GetChatHelper()->FormatQuest(quest);
+                }
+                else
+                {
+                    placeholders["%random_taken_quest_or_item_link"] = placeholders["%random_inventory_item_link"];
+                }
 
-        return BroadcastToChannelWithGlobalChance(
-            ai,
-            BOT_TEXT2("suggest_toxic_links", placeholders),
+                placeholders["%my_role"] = ChatHelper::FormatClass(bot, AiFactory::GetPlayerSpecTab(bot));
+                AreaTableEntry const* current_area = ai->GetCurrentArea();
+                AreaTableEntry const* current_zone = ai->GetCurrentZone();
+                placeholders["%area_name"] = current_area ? ai->GetLocalizedAreaName(current_area) : BOT_TEXT1("string_unknown_area");
+                placeholders["%zone_name"] = current_zone ? ai->GetLocalizedAreaName(current_zone) : BOT_TEXT1("string_unknown_area");
+                placeholders["%my_class"] = ai->GetChatHelper()->FormatClass(bot->getClass());
+                placeholders["%my_race"] = ai->GetChatHelper()->FormatRace(bot->getRace());
+                placeholders["%my_level"] = std::to_string(bot->GetLevel());
+
+                return BOT_TEXT2("suggest_toxic_links", placeholders);
+            },
             { {TO_GUILD, 10}, {TO_WORLD, 70}, {TO_GENERAL, 100} }
         );
     }
@@ -945,13 +914,16 @@ bool BroadcastHelper::BroadcastSuggestThunderfury(PlayerbotAI* ai, Player* bot)
 {
     if (urand(1, sPlayerbotAIConfig->broadcastChanceMaxValue) <= sPlayerbotAIConfig->broadcastChanceSuggestThunderfury)
     {
-        std::map<std::string, std::string> placeholders;
-        ItemTemplate const* thunderfuryProto = sObjectMgr->GetItemTemplate(19019);
-        placeholders["%thunderfury_link"] = GET_PLAYERBOT_AI(bot)->GetChatHelper()->FormatItem(thunderfuryProto);
-
         return BroadcastToChannelWithGlobalChance(
             ai,
-            BOT_TEXT2("thunderfury_spam", placeholders),
+            [&]()
+            {
+                std::map<std::string, std::string> placeholders;
+                ItemTemplate const* thunderfuryProto = sObjectMgr->GetItemTemplate(19019);
+                placeholders["%thunderfury_link"] = GET_PLAYERBOT_AI(bot)->GetChatHelper()->FormatItem(thunderfuryProto);
+
+                return BOT_TEXT2("thunderfury_spam", placeholders);
+            },
             { {TO_WORLD, 70}, {TO_GENERAL, 100} }
         );
     }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <functional>
+
 class PlayerbotAI;
 class Player;
 class ItemTemplate;
@@ -32,7 +34,7 @@ public:
     );
     static bool BroadcastToChannelWithGlobalChance(
         PlayerbotAI* ai,
-        std::string message,
+        std::function<std::string()> const& composeMessage,
         std::list<std::pair<ToChannel, uint32_t>> toChannels
     );
     static bool BroadcastLootingItem(
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#include "ChatDispatcher.h"
+
+#include <algorithm>
+#include <string_view>
+#include <unordered_set>
+
+#include "CharacterCache.h"
+#include "ChatHelper.h"
+#include "Playerbots.h"
+#include "Timer.h"
+#include "WorldPacket.h"
+
+// same packet delivered to several bots within this window is parsed only once
+static constexpr uint32 CHAT_PARSE_CACHE_TIME = 1000;
+
+static const std::unordered_set<std::string> noReplyMsgs = {
+    "join",
+    "leave",
+    "follow",
+    "attack",
+    "pull",
+    "flee",
+    "reset",
+    "reset ai",
+    "all ?",
+    "talents",
+    "talents list",
+    "talents auto",
+    "talk",
+    "stay",
+    "stats",
+    "who",
+    "items",
+    "leave",
+    "join",
+    "repair",
+    "summon",
+    "nc ?",
+    "co ?",
+    "de ?",
+    "dead ?",
+    "follow",
+    "los",
+    "guard",
+    "do accept invitation",
+    "stats",
+    "react ?",
+    "reset strats",
+    "home",
+};
+static const std::unordered_set<std::string> noReplyMsgParts = {
+    "+", "-", "@", "follow target", "focus heal", "cast ", "accept [", "e [", "destroy [", "go zone"};
+static const std::unordered_set<std::string> noReplyMsgStarts = {"e ", "accept ", "cast ", "destroy "};
+
+
+static bool IsNoReplyMessage(std::string const& msg)
+{
+    // if we're just commanding bots around, don't respond...
+    // first one is for exact word matches
+    if (noReplyMsgs.find(msg) != noReplyMsgs.end())
+        return true;
+
+    // second one is for partial matches like + or - where we change strats
+    if (std::any_of(noReplyMsgParts.begin(), noReplyMsgParts.end(),
+                    [&msg](std::string const& part) { return msg.find(part) != std::string::npos; }))
+        return true;
+
+    return std::any_of(noReplyMsgStarts.begin(), noReplyMsgStarts.end(),
+                       [&msg](std::string const& start) { return msg.find(start) == 0; });
+}
+
+ParsedChatMessagePtr ChatDispatcher::Parse(WorldPacket const& packet)
+{
+    if (packet.empty() || packet.size() > packet.DEFAULT_SIZE)
+        return nullptr;
+
+    std::string raw(reinterpret_cast<char const*>(packet.contents()), packet.size());
+    raw.push_back(static_cast<char>(packet.GetOpcode() == SMSG_GM_MESSAGECHAT));
+    size_t hash = std::hash<std::string_view>()(raw);
+    uint32 now = getMSTime();
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        for (CachedChatMessage const& cached : recent)
+        {
+            if (cached.hash == hash && getMSTimeDiff(cached.time, now) < CHAT_PARSE_CACHE_TIME && cached.raw == raw)
+                return cached.message;
+        }
+    }
+
+    ParsedChatMessagePtr message = ParsePacket(packet);
+
+    std::lock_guard<std::mutex> guard(lock);
+    CachedChatMessage& slot = recent[nextSlot];
+    nextSlot = (nextSlot + 1) % recent.size();
+    slot.hash = hash;
+    slot.time = now;
+    slot.raw = std::move(raw);
+    slot.message = message;
+    return message;
+}
+
+ParsedChatMessagePtr ChatDispatcher::ParsePacket(WorldPacket const& packet)
+{
+    WorldPacket p(packet);
+    p.rpos(0);
+
+    uint8 msgtype, chatTag;
+    uint32 lang, textLen, unused;
+    ObjectGuid guid1, guid2;
+    std::string name;
+    std::string chanName;
+    std::string message;
+
+    p >> msgtype >> lang;
+    p >> guid1 >> unused;
+    if (guid1.IsEmpty())
+        return nullptr;
+
+    if (p.GetOpcode() == SMSG_GM_MESSAGECHAT)
+    {
+        p >> textLen;
+        p >> name;
+    }
+
+    switch (msgtype)
+    {
+        case CHAT_MSG_CHANNEL:
+            p >> chanName;
+            [[fallthrough]];
+        case CHAT_MSG_SAY:
+        case CHAT_MSG_PARTY:
+        case CHAT_MSG_YELL:
+        case CHAT_MSG_WHISPER:
+        case CHAT_MSG_GUILD:
+            p >> guid2;
+            p >> textLen >> message >> chatTag;
+            break;
+        default:
+            return nullptr;
+    }
+
+    std::shared_ptr<ParsedChatMessage> parsed = std::make_shared<ParsedChatMessage>();
+    parsed->type = msgtype;
+    parsed->lang = lang;
+    parsed->sender = guid1;
+    parsed->target = guid2;
+    parsed->channelName = std::move(chanName);
+    parsed->senderName = std::move(name);
+    sCharacterCache->GetCharacterNameByGuid(guid1, parsed->senderName);
+    parsed->fromFreeBot =
+        sPlayerbotAIConfig->IsInRandomAccountList(sCharacterCache->GetCharacterAccountIdByGuid(guid1));
+    parsed->noReply = IsNoReplyMessage(message);
+
+    std::set<uint32> itemIds = ChatHelper::ExtractAllItemIds(message);
+    parsed->toxicLinks = message.starts_with(sPlayerbotAIConfig->toxicLinksPrefix) &&
+                         (!itemIds.empty() || !ChatHelper::ExtractAllQuestIds(message).empty());
+    parsed->thunderfury = itemIds.count(19019) > 0;
+    parsed->message = std::move(message);
+    return parsed;
+}
+
+bool ChatDispatcher::ClaimResponder(ParsedChatMessagePtr const& message)
+{
+    return message->responders.fetch_add(1) < sPlayerbotAIConfig->maxChatRespondersPerMessage;
+}
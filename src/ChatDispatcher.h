@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#ifndef _PLAYERBOT_CHATDISPATCHER_H
+#define _PLAYERBOT_CHATDISPATCHER_H
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include "Common.h"
+#include "ObjectGuid.h"
+
+class WorldPacket;
+
+// Chat message as seen by every bot that hears it, parsed and classified once.
+struct ParsedChatMessage
+{
+    uint32 type = 0;
+    uint32 lang = 0;
+    ObjectGuid sender;
+    ObjectGuid target;
+    std::string channelName;
+    std::string message;
+    std::string senderName;
+    bool fromFreeBot = false;
+    bool noReply = false;  // bot command, never answered
+    bool toxicLinks = false;
+    bool thunderfury = false;
+    mutable std::atomic<uint32> responders{0};
+};
+
+typedef std::shared_ptr<ParsedChatMessage const> ParsedChatMessagePtr;
+
+class ChatDispatcher
+{
+public:
+    ChatDispatcher() {}
+    virtual ~ChatDispatcher() {}
+    static ChatDispatcher* instance()
+    {
+        static ChatDispatcher instance;
+        return &instance;
+    }
+
+    // Returns the shared parse of a SMSG_MESSAGECHAT packet or nullptr if bots never reply to it.
+    ParsedChatMessagePtr Parse(WorldPacket const& packet);
+    // Reserves one of the limited reply slots of a message.
+    bool ClaimResponder(ParsedChatMessagePtr const& message);
+
+private:
+    struct CachedChatMessage
+    {
+        size_t hash = 0;
+        uint32 time = 0;
+        std::string raw;
+        ParsedChatMessagePtr message;
+    };
+
+    ParsedChatMessagePtr ParsePacket(WorldPacket const& packet);
+
+    std::array<CachedChatMessage, 32> recent;
+    uint32 nextSlot = 0;
+    std::mutex lock;
+};
+
+#define sChatDispatcher ChatDispatcher::instance()
+
+#endif
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#include "CraftSpellIndex.h"
+
+#include <algorithm>
+
+#include "Log.h"
+#include "SpellInfo.h"
+#include "SpellMgr.h"
+
+void CraftSpellIndex::Init()
+{
+    // Built from the spell store only, which a config reload does not touch
+    if (!spellsByReagent.empty())
+        return;
+
+    uint32 reagents = 0;
+    for (uint32 spellId = 0; spellId < sSpellMgr->GetSpellInfoStoreSize(); ++spellId)
+    {
+        SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
+        if (!spellInfo || spellInfo->IsPassive())
+            continue;
+
+        for (uint8 i = 0; i < 3; ++i)
+        {
+            uint32 productId = spellInfo->Effects[i].ItemType;
+            if (spellInfo->Effects[i].Effect != SPELL_EFFECT_CREATE_ITEM || !productId)
+                continue;
+
+            std::vector<uint32>& producers = spellsByProduct[productId];
+            if (std::find(producers.begin(), producers.end(), spellId) == producers.end())
+                producers.push_back(spellId);
+        }
+
+        if (spellInfo->Effects[EFFECT_0].Effect != SPELL_EFFECT_CREATE_ITEM)
+            continue;
+
+        CraftSpell craft{spellId, 0, 0};
+        SkillLineAbilityMapBounds bounds = sSpellMgr->GetSkillLineAbilityMapBounds(spellId);
+        if (bounds.first != bounds.second)
+        {
+            craft.skillId = bounds.first->second->SkillLine;
+            craft.minSkill = bounds.first->second->MinSkillLineRank;
+        }
+
+        for (uint8 i = 0; i < MAX_SPELL_REAGENTS; ++i)
+        {
+            if (spellInfo->ReagentCount[i] <= 0 || spellInfo->Reagent[i] <= 0)
+                continue;
+
+            std::vector<CraftSpell>& crafts = spellsByReagent[spellInfo->Reagent[i]];
+            if (!crafts.empty() && crafts.back().spellId == spellId)
+                continue;
+
+            crafts.push_back(craft);
+            ++reagents;
+        }
+    }
+
+    LOG_INFO("playerbots", "Indexed {} reagents used by {} recipe slots and {} crafted items", spellsByReagent.size(), reagents,
+             spellsByProduct.size());
+}
+
+std::vector<CraftSpell> const& CraftSpellIndex::GetSpellsUsingReagent(uint32 itemId) const
+{
+    static std::vector<CraftSpell> const empty;
+
+    auto itr = spellsByReagent.find(itemId);
+    return itr != spellsByReagent.end() ? itr->second : empty;
+}
+
+std::vector<uint32> const& CraftSpellIndex::GetSpellsCreatingItem(uint32 itemId) const
+{
+    static std::vector<uint32> const empty;
+
+    auto itr = spellsByProduct.find(itemId);
+    return itr != spellsByProduct.end() ? itr->second : empty;
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#ifndef _PLAYERBOT_CRAFTSPELLINDEX_H
+#define _PLAYERBOT_CRAFTSPELLINDEX_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "Common.h"
+
+struct CraftSpell
+{
+    uint32 spellId;
+    uint32 skillId;
+    uint32 minSkill;
+};
+
+// Reverse lookups over the spell store built once at startup: which craft spells consume a reagent and which
+// spells create an item. Bots only have to check the few candidates against their own spell book.
+class CraftSpellIndex
+{
+public:
+    CraftSpellIndex() {}
+    virtual ~CraftSpellIndex() {}
+    static CraftSpellIndex* instance()
+    {
+        static CraftSpellIndex instance;
+        return &instance;
+    }
+
+    void Init();
+
+    std::vector<CraftSpell> const& GetSpellsUsingReagent(uint32 itemId) const;
+    std::vector<uint32> const& GetSpellsCreatingItem(uint32 itemId) const;
+
+private:
+    std::unordered_map<uint32, std::vector<CraftSpell>> spellsByReagent;
+    std::unordered_map<uint32, std::vector<uint32>> spellsByProduct;
+};
+
+#define sCraftSpellIndex CraftSpellIndex::instance()
+
+#endif
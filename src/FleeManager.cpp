@@ -5,6 +5,9 @@
 
 #include "FleeManager.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "Playerbots.h"
 #include "ServerFacade.h"
 
@@ -18,34 +21,75 @@ FleeManager::FleeManager(Player* bot, float maxAllowedDistance, float followAngl
 {
 }
 
-void FleeManager::calculateDistanceToCreatures(FleePoint* point)
+// terrain, water and LOS are only queried for this many best scored candidates
+static constexpr uint32 MAX_FLEE_TERRAIN_CHECKS = 8;
+
+void FleeCandidates::Clear()
+{
+    x.clear();
+    y.clear();
+    sumDistance.clear();
+    minDistance.clear();
+    order.clear();
+}
+
+void FleeCandidates::Add(float px, float py)
 {
-    point->minDistance = -1.0f;
-    point->sumDistance = 0.0f;
+    x.push_back(px);
+    y.push_back(py);
+}
+
+void FleeThreats::Clear()
+{
+    x.clear();
+    y.clear();
+    size.clear();
+    angle.clear();
+}
+
+void FleeThreats::Score(float px, float py, float& sumDistance, float& minDistance) const
+{
+    minDistance = -1.0f;
+    sumDistance = 0.0f;
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        // same as ServerFacade::GetDistance2d, without the unit lookup
+        float d = std::max(0.0f, std::sqrt((x[i] - px) * (x[i] - px) + (y[i] - py) * (y[i] - py)) - size[i]);
+        d = std::round(d * 10.0f) / 10.0f;
+        sumDistance += d;
+        if (minDistance < 0 || minDistance > d)
+            minDistance = d;
+    }
+}
+
+bool FleeManager::collectThreats(FleeThreats& threats)
+{
+    threats.Clear();
     PlayerbotAI* botAI = GET_PLAYERBOT_AI(bot);
     if (!botAI)
     {
-        return;
+        return false;
     }
-    GuidVector units = *botAI->GetAiObjectContext()->GetValue<GuidVector>("possible targets no los");
-    for (GuidVector::iterator i = units.begin(); i != units.end(); ++i)
+    GuidVector const& units = botAI->GetAiObjectContext()->GetValue<GuidVector>("possible targets no los")->Get();
+    for (ObjectGuid const& guid : units)
     {
-        Unit* unit = botAI->GetUnit(*i);
+        Unit* unit = botAI->GetUnit(guid);
         if (!unit)
             continue;
 
-        float d = sServerFacade->GetDistance2d(unit, point->x, point->y);
-        point->sumDistance += d;
-        if (point->minDistance < 0 || point->minDistance > d)
-            point->minDistance = d;
+        threats.x.push_back(unit->GetPositionX());
+        threats.y.push_back(unit->GetPositionY());
+        threats.size.push_back(unit->GetObjectSize());
+        threats.angle.push_back(bot->GetAngle(unit));
     }
+
+    return true;
 }
 
-bool intersectsOri(float angle, std::vector<float>& angles, float angleIncrement)
+bool intersectsOri(float angle, std::vector<float> const& angles, float angleIncrement)
 {
-    for (std::vector<float>::iterator i = angles.begin(); i != angles.end(); ++i)
+    for (float ori : angles)
     {
-        float ori = *i;
         if (abs(angle - ori) < angleIncrement)
             return true;
     }
@@ -53,33 +97,13 @@ bool intersectsOri(float angle, std::vector<float>& angles, float angleIncrement
     return false;
 }
 
-void FleeManager::calculatePossibleDestinations(std::vector<FleePoint*>& points)
+void FleeManager::calculatePossibleDestinations(FleeThreats const& threats, FleeCandidates& candidates)
 {
-    PlayerbotAI* botAI = GET_PLAYERBOT_AI(bot);
-    if (!botAI)
-    {
-        return;
-    }
-    Unit* target = *botAI->GetAiObjectContext()->GetValue<Unit*>("current target");
-
     float botPosX = startPosition.getX();
     float botPosY = startPosition.getY();
-    float botPosZ = startPosition.getZ();
 
-    FleePoint start(botAI, botPosX, botPosY, botPosZ);
-    calculateDistanceToCreatures(&start);
-
-    std::vector<float> enemyOri;
-    GuidVector units = *botAI->GetAiObjectContext()->GetValue<GuidVector>("possible targets no los");
-    for (GuidVector::iterator i = units.begin(); i != units.end(); ++i)
-    {
-        Unit* unit = botAI->GetUnit(*i);
-        if (!unit)
-            continue;
-
-        float ori = bot->GetAngle(unit);
-        enemyOri.push_back(ori);
-    }
+    float startSumDistance, startMinDistance;
+    threats.Score(botPosX, botPosY, startSumDistance, startMinDistance);
 
     float distIncrement = std::max(sPlayerbotAIConfig->followDistance,
                                    (maxAllowedDistance - sPlayerbotAIConfig->tooCloseDistance) / 10.0f);
@@ -91,84 +115,85 @@ void FleeManager::calculatePossibleDestinations(std::vector<FleePoint*>& points)
             for (float angle = add; angle < add + 2 * static_cast<float>(M_PI) + angleIncrement;
                  angle += static_cast<float>(M_PI) / 4)
             {
-                if (intersectsOri(angle, enemyOri, angleIncrement))
+                if (intersectsOri(angle, threats.angle, angleIncrement))
                     continue;
 
-                float x = botPosX + cos(angle) * maxAllowedDistance, y = botPosY + sin(angle) * maxAllowedDistance,
-                      z = botPosZ + CONTACT_DISTANCE;
+                float x = botPosX + cos(angle) * maxAllowedDistance, y = botPosY + sin(angle) * maxAllowedDistance;
                 if (forceMaxDistance &&
                     sServerFacade->IsDistanceLessThan(sServerFacade->GetDistance2d(bot, x, y),
                                                       maxAllowedDistance - sPlayerbotAIConfig->tooCloseDistance))
                     continue;
 
-                bot->UpdateAllowedPositionZ(x, y, z);
-
-                Map* map = startPosition.getMap();
-                if (map && map->IsInWater(bot->GetPhaseMask(), x, y, z, bot->GetCollisionHeight()))
-                    continue;
-
-                if (!bot->IsWithinLOS(x, y, z) || (target && !target->IsWithinLOS(x, y, z)))
-                    continue;
-
-                FleePoint* point = new FleePoint(botAI, x, y, z);
-                calculateDistanceToCreatures(point);
-
-                if (sServerFacade->IsDistanceGreaterOrEqualThan(point->minDistance - start.minDistance,
-                                                                sPlayerbotAIConfig->followDistance))
-                    points.push_back(point);
-                else
-                    delete point;
+                candidates.Add(x, y);
             }
         }
     }
-}
 
-void FleeManager::cleanup(std::vector<FleePoint*>& points)
-{
-    for (std::vector<FleePoint*>::iterator i = points.begin(); i != points.end(); i++)
+    // score every candidate against every threat in one pass
+    size_t count = candidates.Size();
+    candidates.sumDistance.resize(count);
+    candidates.minDistance.resize(count);
+    for (size_t i = 0; i < count; ++i)
+        threats.Score(candidates.x[i], candidates.y[i], candidates.sumDistance[i], candidates.minDistance[i]);
+
+    for (size_t i = 0; i < count; ++i)
     {
-        delete *i;
+        if (sServerFacade->IsDistanceGreaterOrEqualThan(candidates.minDistance[i] - startMinDistance,
+                                                        sPlayerbotAIConfig->followDistance))
+            candidates.order.push_back(i);
     }
-
-    points.clear();
 }
 
-bool FleeManager::isBetterThan(FleePoint* point, FleePoint* other)
+bool FleeManager::selectOptimalDestination(FleeCandidates& candidates, float* rx, float* ry, float* rz)
 {
-    return point->sumDistance - other->sumDistance > 0;
-}
+    PlayerbotAI* botAI = GET_PLAYERBOT_AI(bot);
+    if (!botAI)
+    {
+        return false;
+    }
+    Unit* target = *botAI->GetAiObjectContext()->GetValue<Unit*>("current target");
+    Map* map = startPosition.getMap();
 
-FleePoint* FleeManager::selectOptimalDestination(std::vector<FleePoint*>& points)
-{
-    FleePoint* best = nullptr;
-    for (std::vector<FleePoint*>::iterator i = points.begin(); i != points.end(); i++)
+    // farthest from all threats first, earlier candidates win ties
+    std::stable_sort(candidates.order.begin(), candidates.order.end(), [&candidates](uint32 lhs, uint32 rhs)
+                     { return candidates.sumDistance[lhs] > candidates.sumDistance[rhs]; });
+
+    uint32 checks = 0;
+    for (uint32 i : candidates.order)
     {
-        FleePoint* point = *i;
-        if (!best || isBetterThan(point, best))
-            best = point;
+        if (++checks > MAX_FLEE_TERRAIN_CHECKS)
+            break;
+
+        float x = candidates.x[i], y = candidates.y[i], z = startPosition.getZ() + CONTACT_DISTANCE;
+        bot->UpdateAllowedPositionZ(x, y, z);
+
+        if (map && map->IsInWater(bot->GetPhaseMask(), x, y, z, bot->GetCollisionHeight()))
+            continue;
+
+        if (!bot->IsWithinLOS(x, y, z) || (target && !target->IsWithinLOS(x, y, z)))
+            continue;
+
+        *rx = x;
+        *ry = y;
+        *rz = z;
+        return true;
     }
 
-    return best;
+    return false;
 }
 
 bool FleeManager::CalculateDestination(float* rx, float* ry, float* rz)
 {
-    std::vector<FleePoint*> points;
-    calculatePossibleDestinations(points);
+    // reused between calls, flee checks of a whole raid run on the same few map threads
+    static thread_local FleeThreats threats;
+    static thread_local FleeCandidates candidates;
 
-    FleePoint* point = selectOptimalDestination(points);
-    if (!point)
-    {
-        cleanup(points);
+    candidates.Clear();
+    if (!collectThreats(threats))
         return false;
-    }
 
-    *rx = point->x;
-    *ry = point->y;
-    *rz = point->z;
-
-    cleanup(points);
-    return true;
+    calculatePossibleDestinations(threats, candidates);
+    return selectOptimalDestination(candidates, rx, ry, rz);
 }
 
 bool FleeManager::isUseful()
@@ -14,23 +14,30 @@
 class Player;
 class PlayerbotAI;
 
-class FleePoint
+// Flee destinations and the threats they are scored against, kept as parallel arrays so one pass
+// scores every candidate without per-point allocations or unit lookups
+struct FleeCandidates
 {
-public:
-    FleePoint(PlayerbotAI* botAI, float x, float y, float z)
-        : botAI(botAI), sumDistance(0.0f), minDistance(0.0f), x(x), y(y), z(z)
-    {
-    }
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> sumDistance;
+    std::vector<float> minDistance;
+    std::vector<uint32> order;
 
-    float x;
-    float y;
-    float z;
+    void Clear();
+    void Add(float px, float py);
+    size_t Size() const { return x.size(); }
+};
 
-    float sumDistance;
-    float minDistance;
+struct FleeThreats
+{
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> size;
+    std::vector<float> angle;
 
-private:
-    PlayerbotAI* botAI;
+    void Clear();
+    void Score(float px, float py, float& sumDistance, float& minDistance) const;
 };
 
 class FleeManager
@@ -43,11 +50,9 @@ public:
     bool isUseful();
 
 private:
-    void calculatePossibleDestinations(std::vector<FleePoint*>& points);
-    void calculateDistanceToCreatures(FleePoint* point);
-    void cleanup(std::vector<FleePoint*>& points);
-    FleePoint* selectOptimalDestination(std::vector<FleePoint*>& points);
-    bool isBetterThan(FleePoint* point, FleePoint* other);
+    bool collectThreats(FleeThreats& threats);
+    void calculatePossibleDestinations(FleeThreats const& threats, FleeCandidates& candidates);
+    bool selectOptimalDestination(FleeCandidates& candidates, float* rx, float* ry, float* rz);
 
     Player* bot;
     float maxAllowedDistance;
@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#include "FormationSolver.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "Group.h"
+#include "Playerbots.h"
+#include "Timer.h"
+
+// layouts older than this are rebuilt on the next request
+static constexpr uint32 FORMATION_LAYOUT_REFRESH_TIME = 1 * IN_MILLISECONDS;
+// layouts nobody asked for in this long are dropped
+static constexpr uint32 FORMATION_LAYOUT_IDLE_TIME = 60 * IN_MILLISECONDS;
+static constexpr uint32 FORMATION_LINE_SIZE = 5;
+
+uint32 FormationLayout::GetFollowIndex(ObjectGuid guid) const
+{
+    auto itr = followIndex.find(guid);
+    return itr != followIndex.end() ? itr->second : 0;
+}
+
+FormationLineSlot const* FormationLayout::GetLineSlot(FormationLineSlots const& slots, ObjectGuid guid) const
+{
+    auto itr = slots.find(guid);
+    return itr != slots.end() ? &itr->second : nullptr;
+}
+
+// Short lines stay single, longer ones are cut into rows of 5 taken from the back of the list
+static void AssignLineSlots(std::vector<ObjectGuid> const& line, FormationLineSlots& slots)
+{
+    uint32 remaining = line.size();
+    if (remaining < FORMATION_LINE_SIZE)
+    {
+        for (uint32 i = 0; i < remaining; ++i)
+            slots[line[i]] = {0, i, remaining};
+
+        return;
+    }
+
+    for (uint32 row = 0; remaining; ++row)
+    {
+        uint32 rowSize = std::min(remaining, FORMATION_LINE_SIZE);
+        for (uint32 column = 0; column < rowSize; ++column)
+            slots[line[remaining - 1 - column]] = {row, column, rowSize};
+
+        remaining -= rowSize;
+    }
+}
+
+std::shared_ptr<FormationLayout> FormationSolver::Solve(Group* group, Player* master, uint32 mapId)
+{
+    std::shared_ptr<FormationLayout> layout = std::make_shared<FormationLayout>();
+    layout->membersCount = group->GetMembersCount();
+    layout->time = getMSTime();
+
+    std::vector<ObjectGuid> roster;
+    std::vector<ObjectGuid> line;
+    std::vector<ObjectGuid> tanks;
+    std::vector<ObjectGuid> dps;
+    bool left = true;  // Used for alternating tanks' positions
+
+    for (GroupReference* ref = group->GetFirstMember(); ref; ref = ref->next())
+    {
+        Player* member = ref->GetSource();
+        if (!member || member == master)
+            continue;
+
+        ObjectGuid guid = member->GetGUID();
+        line.push_back(guid);
+
+        // Roles of members on other maps are not looked at, their bots update on other threads
+        if (member->GetMapId() != mapId)
+            continue;
+
+        bool isTank = PlayerbotAI::IsTank(member);
+        if (isTank)
+            tanks.push_back(guid);
+        else
+            dps.push_back(guid);
+
+        // Skip dead members
+        if (!member->IsAlive())
+            continue;
+
+        // Put DPS and healers in the middle, alternate tanks between front and back
+        if (!isTank || PlayerbotAI::IsHeal(member))
+            roster.insert(roster.begin() + roster.size() / 2, guid);
+        else
+        {
+            if (left)
+                roster.push_back(guid);
+            else
+                roster.insert(roster.begin(), guid);
+
+            left = !left;
+        }
+    }
+
+    for (uint32 i = 0; i < roster.size(); ++i)
+        layout->followIndex[roster[i]] = i + 1;
+
+    layout->followTotal = roster.size() + 1;
+
+    if (master)
+    {
+        ObjectGuid guid = master->GetGUID();
+        line.insert(line.begin() + std::min<size_t>(layout->membersCount / 2, line.size()), guid);
+
+        layout->masterIsTank = master->GetMapId() == mapId && PlayerbotAI::IsTank(master);
+        if (layout->masterIsTank)
+            tanks.insert(tanks.begin() + (tanks.size() + 1) / 2, guid);
+        else
+            dps.insert(dps.begin() + (dps.size() + 1) / 2, guid);
+    }
+
+    AssignLineSlots(line, layout->line);
+    AssignLineSlots(tanks, layout->shieldTanks);
+    AssignLineSlots(dps, layout->shieldDps);
+    layout->shieldTanksSize = tanks.size();
+    layout->shieldDpsSize = dps.size();
+
+    return layout;
+}
+
+std::shared_ptr<FormationLayout const> FormationSolver::GetLayout(Group* group, Player* master, uint32 mapId)
+{
+    if (!group)
+        return nullptr;
+
+    Key key(group->GetGUID(), master ? master->GetGUID() : ObjectGuid::Empty, mapId);
+    uint32 now = getMSTime();
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        auto itr = layouts.find(key);
+        if (itr != layouts.end() && itr->second->membersCount == group->GetMembersCount() &&
+            getMSTimeDiff(itr->second->time, now) < FORMATION_LAYOUT_REFRESH_TIME)
+            return itr->second;
+    }
+
+    // Solved outside the lock so bots of other groups are not held up, two bots racing just solve twice
+    std::shared_ptr<FormationLayout const> layout = Solve(group, master, mapId);
+
+    std::lock_guard<std::mutex> guard(lock);
+    layouts[key] = layout;
+    return layout;
+}
+
+void FormationSolver::Update()
+{
+    uint32 now = getMSTime();
+    if (getMSTimeDiff(lastCleanupTime, now) < FORMATION_LAYOUT_IDLE_TIME)
+        return;
+
+    lastCleanupTime = now;
+
+    std::lock_guard<std::mutex> guard(lock);
+    for (auto itr = layouts.begin(); itr != layouts.end();)
+    {
+        if (getMSTimeDiff(itr->second->time, now) >= FORMATION_LAYOUT_IDLE_TIME)
+            itr = layouts.erase(itr);
+        else
+            ++itr;
+    }
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#ifndef _PLAYERBOT_FORMATIONSOLVER_H
+#define _PLAYERBOT_FORMATIONSOLVER_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+
+#include "Common.h"
+#include "ObjectGuid.h"
+
+class Group;
+class Player;
+
+// Slot of a member in a formation line, lines hold at most 5 members and are counted from the center
+struct FormationLineSlot
+{
+    uint32 row = 0;
+    uint32 column = 0;
+    uint32 rowSize = 0;
+};
+
+typedef std::unordered_map<ObjectGuid, FormationLineSlot> FormationLineSlots;
+
+// Slots of every group member in all group formations, as seen by bots following one master on one map
+struct FormationLayout
+{
+    uint32 membersCount = 0;
+    uint32 time = 0;
+
+    // follow formations: 1-based position among alive members on the map, master excluded
+    std::unordered_map<ObjectGuid, uint32> followIndex;
+    uint32 followTotal = 1;
+
+    // line formation: group order with the master in the middle
+    FormationLineSlots line;
+
+    // shield formation: tanks and the rest on the map each in their own line, the master joins the line of its role
+    FormationLineSlots shieldTanks;
+    FormationLineSlots shieldDps;
+    uint32 shieldTanksSize = 0;
+    uint32 shieldDpsSize = 0;
+    bool masterIsTank = false;
+
+    uint32 GetFollowIndex(ObjectGuid guid) const;
+    FormationLineSlot const* GetLineSlot(FormationLineSlots const& slots, ObjectGuid guid) const;
+};
+
+// Lays out a group once for all its members instead of every bot sorting the roster on each follow decision.
+// Layouts are rebuilt when the group size changes and at most once a second otherwise, so deaths and role
+// changes are picked up shortly after. Returned layouts are immutable and may be kept while others rebuild.
+class FormationSolver
+{
+public:
+    FormationSolver() {}
+    virtual ~FormationSolver() {}
+    static FormationSolver* instance()
+    {
+        static FormationSolver instance;
+        return &instance;
+    }
+
+    std::shared_ptr<FormationLayout const> GetLayout(Group* group, Player* master, uint32 mapId);
+    // Drops layouts of groups nobody followed lately, world thread only
+    void Update();
+
+private:
+    static std::shared_ptr<FormationLayout> Solve(Group* group, Player* master, uint32 mapId);
+
+    typedef std::tuple<ObjectGuid, ObjectGuid, uint32> Key;
+
+    std::mutex lock;
+    std::map<Key, std::shared_ptr<FormationLayout const>> layouts;
+    uint32 lastCleanupTime = 0;
+};
+
+#define sFormationSolver FormationSolver::instance()
+
+#endif
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#include "InventoryIndex.h"
+
+#include "Bag.h"
+#include "Item.h"
+#include "Player.h"
+#include "Timer.h"
+
+// split stacks and items created in place send no push result, rebuild now and then to pick them up
+static constexpr uint32 INVENTORY_INDEX_MAX_AGE = 5000;
+
+static std::vector<Item*> const emptyItems;
+
+void InventoryIndex::Refresh(Player* owner, uint32 inventoryVersion)
+{
+    if (built && !iterations &&
+        (bot != owner || builtVersion != inventoryVersion || !builtInWorld || !owner->IsInWorld() ||
+         getMSTimeDiff(buildTime, getMSTime()) > INVENTORY_INDEX_MAX_AGE))
+        built = false;
+
+    bot = owner;
+    version = inventoryVersion;
+}
+
+void InventoryIndex::Add(Item* item, uint8 bag, uint8 slot)
+{
+    ItemTemplate const* proto = item->GetTemplate();
+    Slot itemSlot = {item->GetGUID(), bag, slot};
+    for (ItemList* list : {&items, &itemsById[proto->ItemId], &itemsByClass[(proto->Class << 16) | proto->SubClass]})
+    {
+        list->items.push_back(item);
+        list->slots.push_back(itemSlot);
+    }
+}
+
+bool InventoryIndex::IsCurrent(ItemList const& list) const
+{
+    for (Slot const& slot : list.slots)
+    {
+        Item* item = bot->GetItemByPos(slot.bag, slot.slot);
+        if (!item || item->GetGUID() != slot.guid)
+            return false;
+    }
+
+    return true;
+}
+
+template <class Visitor>
+void InventoryIndex::VisitSlots(Visitor visitor)
+{
+    for (uint32 i = INVENTORY_SLOT_ITEM_START; i < INVENTORY_SLOT_ITEM_END; ++i)
+        if (Item* pItem = bot->GetItemByPos(INVENTORY_SLOT_BAG_0, i))
+            visitor(pItem, INVENTORY_SLOT_BAG_0, i);
+
+    for (uint32 i = KEYRING_SLOT_START; i < KEYRING_SLOT_END; ++i)
+        if (Item* pItem = bot->GetItemByPos(INVENTORY_SLOT_BAG_0, i))
+            visitor(pItem, INVENTORY_SLOT_BAG_0, i);
+
+    for (uint32 i = INVENTORY_SLOT_BAG_START; i < INVENTORY_SLOT_BAG_END; ++i)
+        if (Bag* pBag = (Bag*)bot->GetItemByPos(INVENTORY_SLOT_BAG_0, i))
+            for (uint32 j = 0; j < pBag->GetBagSize(); ++j)
+                if (Item* pItem = pBag->GetItemByPos(j))
+                    visitor(pItem, i, j);
+
+    for (uint8 slot = EQUIPMENT_SLOT_START; slot < EQUIPMENT_SLOT_END; slot++)
+        if (Item* pItem = bot->GetItemByPos(INVENTORY_SLOT_BAG_0, slot))
+            visitor(pItem, INVENTORY_SLOT_BAG_0, slot);
+}
+
+void InventoryIndex::EndIteration()
+{
+    if (!--iterations)
+        scanned.clear();
+}
+
+std::vector<Item*> const& InventoryIndex::Lookup(std::unordered_map<uint32, ItemList> const& lists, uint32 key,
+                                                 bool byClass)
+{
+    if (!built)
+        Rebuild();
+
+    auto i = lists.find(key);
+    if (builtVersion == version)
+    {
+        if (i == lists.end())
+            return emptyItems;
+
+        if (IsCurrent(i->second))
+            return i->second.items;
+    }
+
+    // the list being iterated must stay put, hand out a fresh scan instead
+    if (iterations)
+    {
+        std::vector<Item*>& result = scanned.emplace_back();
+        VisitSlots(
+            [&result, key, byClass](Item* item, uint8 /*bag*/, uint8 /*slot*/)
+            {
+                ItemTemplate const* proto = item->GetTemplate();
+                if ((byClass ? (proto->Class << 16) | proto->SubClass : proto->ItemId) == key)
+                    result.push_back(item);
+            });
+
+        return result;
+    }
+
+    Rebuild();
+    i = lists.find(key);
+    return i != lists.end() ? i->second.items : emptyItems;
+}
+
+void InventoryIndex::Rebuild()
+{
+    items.items.clear();
+    items.slots.clear();
+    itemsById.clear();
+    itemsByClass.clear();
+
+    VisitSlots([this](Item* item, uint8 bag, uint8 slot) { Add(item, bag, slot); });
+
+    built = true;
+    builtInWorld = bot->IsInWorld();
+    builtVersion = version;
+    buildTime = getMSTime();
+}
+
+std::vector<Item*> const& InventoryIndex::GetItems()
+{
+    // kept current by Refresh through the inventory version
+    if (!built)
+        Rebuild();
+
+    return items.items;
+}
+
+std::vector<Item*> const& InventoryIndex::GetItems(uint32 itemId) { return Lookup(itemsById, itemId, false); }
+
+std::vector<Item*> const& InventoryIndex::GetItemsByClass(uint32 itemClass, uint32 itemSubClass)
+{
+    return Lookup(itemsByClass, (itemClass << 16) | itemSubClass, true);
+}
+
+uint32 InventoryIndex::GetItemCount(uint32 itemId, bool inBagsOnly)
+{
+    uint32 count = 0;
+    for (Item* item : GetItems(itemId))
+    {
+        if (!inBagsOnly || !item->IsEquipped())
+            count += item->GetCount();
+    }
+
+    return count;
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#ifndef _PLAYERBOT_INVENTORYINDEX_H
+#define _PLAYERBOT_INVENTORYINDEX_H
+
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+#include "Common.h"
+#include "ObjectGuid.h"
+
+class Item;
+class Player;
+
+// Items in the bot's bags and equipment slots, grouped by item id and by class/subclass. Rebuilt when the
+// inventory version of the bot changes, so lookups between changes do not walk the bags again. Item counts
+// and equipped state are read from the items themselves and are always current. Item packets are not seen while
+// the bot is out of world, so the index is never kept across that. Lists by id and class are also checked against
+// the bot's slots before they are handed out.
+class InventoryIndex
+{
+public:
+    // Drops the index when the inventory changed since it was built, the next lookup rebuilds it
+    void Refresh(Player* owner, uint32 inventoryVersion);
+
+    // In iteration order: backpack, keyring, bags, then equipment
+    std::vector<Item*> const& GetItems();
+    std::vector<Item*> const& GetItems(uint32 itemId);
+    std::vector<Item*> const& GetItemsByClass(uint32 itemClass, uint32 itemSubClass);
+    uint32 GetItemCount(uint32 itemId, bool inBagsOnly = true);
+
+    // Keeps the lists stable while they are iterated, lookups made by visitors scan the bags instead of rebuilding
+    void BeginIteration() { ++iterations; }
+    void EndIteration();
+
+private:
+    struct Slot
+    {
+        ObjectGuid guid;
+        uint8 bag;
+        uint8 slot;
+    };
+
+    // items and the slots they were found in, compared by guid so cached pointers are never dereferenced
+    struct ItemList
+    {
+        std::vector<Item*> items;
+        std::vector<Slot> slots;
+    };
+
+    template <class Visitor>
+    void VisitSlots(Visitor visitor);
+    void Rebuild();
+    void Add(Item* item, uint8 bag, uint8 slot);
+    bool IsCurrent(ItemList const& list) const;
+    std::vector<Item*> const& Lookup(std::unordered_map<uint32, ItemList> const& lists, uint32 key, bool byClass);
+
+    Player* bot = nullptr;
+    bool built = false;
+    bool builtInWorld = false;
+    uint32 iterations = 0;
+    // latest inventory version seen and the one the lists were built at, apart while lists are iterated
+    uint32 version = 0;
+    uint32 builtVersion = 0;
+    uint32 buildTime = 0;
+    ItemList items;
+    std::unordered_map<uint32, ItemList> itemsById;
+    std::unordered_map<uint32, ItemList> itemsByClass;
+    // lists scanned while others were iterated, kept until the iteration ends
+    std::deque<std::vector<Item*>> scanned;
+};
+
+#endif
@@ -9,14 +9,22 @@
 #include "Playerbots.h"
 #include "Unit.h"
 
-#define MAX_LOOT_OBJECT_COUNT 10
+#define LOOT_FEASIBILITY_CHECK_INTERVAL 1000
 
-LootTarget::LootTarget(ObjectGuid guid) : guid(guid), asOfTime(time(nullptr)) {}
+LootTarget::LootTarget(ObjectGuid guid)
+    : guid(guid), asOfTime(time(nullptr)), lootChecked(false), lootPossible(false), inventoryVersion(0), checkTime(0)
+{
+}
 
 LootTarget::LootTarget(LootTarget const& other)
 {
     guid = other.guid;
     asOfTime = other.asOfTime;
+    loot = other.loot;
+    lootChecked = other.lootChecked;
+    lootPossible = other.lootPossible;
+    inventoryVersion = other.inventoryVersion;
+    checkTime = other.checkTime;
 }
 
 LootTarget& LootTarget::operator=(LootTarget const& other)
@@ -26,6 +34,11 @@ LootTarget& LootTarget::operator=(LootTarget const& other)
 
     guid = other.guid;
     asOfTime = other.asOfTime;
+    loot = other.loot;
+    lootChecked = other.lootChecked;
+    lootPossible = other.lootPossible;
+    inventoryVersion = other.inventoryVersion;
+    checkTime = other.checkTime;
 
     return *this;
 }
@@ -312,32 +325,10 @@ bool LootObject::IsLootPossible(Player* bot)
     uint32 skillValue = uint32(bot->GetSkillValue(skillId));
     if (reqSkillValue > skillValue)
         return false;
-    
-    if (skillId == SKILL_MINING &&
-        !bot->HasItemCount(756, 1) &&
-        !bot->HasItemCount(778, 1) &&
-        !bot->HasItemCount(1819, 1) &&
-        !bot->HasItemCount(1893, 1) &&
-        !bot->HasItemCount(1959, 1) &&
-        !bot->HasItemCount(2901, 1) &&
-        !bot->HasItemCount(9465, 1) &&
-        !bot->HasItemCount(20723, 1) &&
-        !bot->HasItemCount(40772, 1) &&
-        !bot->HasItemCount(40892, 1) &&
-        !bot->HasItemCount(40893, 1))
-    {
-        return false;  // Bot is missing a mining pick
-    }
-    
-    if (skillId == SKILL_SKINNING &&
-        !bot->HasItemCount(7005, 1) &&
-        !bot->HasItemCount(40772, 1) &&
-        !bot->HasItemCount(40893, 1) &&
-        !bot->HasItemCount(12709, 1) &&
-        !bot->HasItemCount(19901, 1))
-    {
-        return false;  // Bot is missing a skinning knife
-    }
+
+    if ((skillId == SKILL_MINING || skillId == SKILL_SKINNING) &&
+        !botAI->GetAiObjectContext()->GetValue<LootObjectStack*>("available loot")->Get()->HasLootTool(skillId))
+        return false;  // Bot is missing a mining pick or skinning knife
 
     return true;
 }
@@ -369,44 +360,92 @@ void LootObjectStack::Remove(ObjectGuid guid)
 
 void LootObjectStack::Clear() { availableLoot.clear(); }
 
-bool LootObjectStack::CanLoot(float maxDistance)
+bool LootObjectStack::CanLoot(float maxDistance) { return FillCandidates(maxDistance, true); }
+
+LootObject LootObjectStack::GetLoot(float maxDistance)
 {
-    std::vector<LootObject> ordered = OrderByDistance(maxDistance);
-    return !ordered.empty();
+    if (!FillCandidates(maxDistance, false))
+        return LootObject();
+
+    return candidates.front().target->loot;
 }
 
-LootObject LootObjectStack::GetLoot(float maxDistance)
+bool LootObjectStack::HasLootTool(uint32 skillId)
+{
+    PlayerbotAI* botAI = GET_PLAYERBOT_AI(bot);
+    uint32 inventoryVersion = botAI ? botAI->GetInventoryVersion() : 0;
+    if (!toolsChecked || toolsInventoryVersion != inventoryVersion)
+    {
+        hasMiningPick = bot->HasItemCount(756, 1) || bot->HasItemCount(778, 1) || bot->HasItemCount(1819, 1) ||
+                        bot->HasItemCount(1893, 1) || bot->HasItemCount(1959, 1) || bot->HasItemCount(2901, 1) ||
+                        bot->HasItemCount(9465, 1) || bot->HasItemCount(20723, 1) || bot->HasItemCount(40772, 1) ||
+                        bot->HasItemCount(40892, 1) || bot->HasItemCount(40893, 1);
+
+        hasSkinningKnife = bot->HasItemCount(7005, 1) || bot->HasItemCount(40772, 1) ||
+                           bot->HasItemCount(40893, 1) || bot->HasItemCount(12709, 1) ||
+                           bot->HasItemCount(19901, 1);
+
+        toolsInventoryVersion = inventoryVersion;
+        toolsChecked = true;
+    }
+
+    switch (skillId)
+    {
+        case SKILL_MINING:
+            return hasMiningPick;
+        case SKILL_SKINNING:
+            return hasSkinningKnife;
+        default:
+            return true;
+    }
+}
+
+bool LootObjectStack::IsLootPossible(LootTarget const& target)
 {
-    std::vector<LootObject> ordered = OrderByDistance(maxDistance);
-    return ordered.empty() ? LootObject() : *ordered.begin();
+    PlayerbotAI* botAI = GET_PLAYERBOT_AI(bot);
+    uint32 inventoryVersion = botAI ? botAI->GetInventoryVersion() : 0;
+    uint32 now = getMSTime();
+    if (!target.lootChecked || target.inventoryVersion != inventoryVersion ||
+        getMSTimeDiff(target.checkTime, now) >= LOOT_FEASIBILITY_CHECK_INTERVAL)
+    {
+        target.loot.Refresh(bot, target.guid);
+        target.lootPossible = target.loot.IsLootPossible(bot);
+        target.lootChecked = true;
+        target.inventoryVersion = inventoryVersion;
+        target.checkTime = now;
+    }
+
+    return target.lootPossible;
 }
-std::vector<LootObject> LootObjectStack::OrderByDistance(float maxDistance)
+
+bool LootObjectStack::FillCandidates(float maxDistance, bool firstOnly)
 {
     availableLoot.shrink(time(nullptr) - 30);
+    candidates.clear();
 
-    std::map<float, LootObject> sortedMap;
-    LootTargetList safeCopy(availableLoot);
-    for (LootTargetList::iterator i = safeCopy.begin(); i != safeCopy.end(); i++)
+    PlayerbotAI* botAI = GET_PLAYERBOT_AI(bot);
+    if (!botAI)
+        return false;
+
+    for (LootTarget const& target : availableLoot)
     {
-        ObjectGuid guid = i->guid;
-        LootObject lootObject(bot, guid);
-        if (!lootObject.IsLootPossible(bot)) // Ensure loot object is valid
+        if (!IsLootPossible(target))
             continue;
 
-        WorldObject* worldObj = lootObject.GetWorldObject(bot);
-        if (!worldObj) // Prevent null pointer dereference
-        {
+        WorldObject* worldObj = botAI->GetWorldObject(target.loot.guid);
+        if (!worldObj)
             continue;
-        }
 
         float distance = bot->GetDistance(worldObj);
-        if (!maxDistance || distance <= maxDistance)
-            sortedMap[distance] = lootObject;
-    }
+        if (maxDistance && distance > maxDistance)
+            continue;
 
-    std::vector<LootObject> result;
-    for (auto& [_, lootObject] : sortedMap)
-        result.push_back(lootObject);
+        candidates.push_back(LootCandidate{distance, &target});
+        std::push_heap(candidates.begin(), candidates.end());
+
+        if (firstOnly)
+            break;
+    }
 
-    return result;
+    return !candidates.empty();
 }
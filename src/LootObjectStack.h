@@ -8,6 +8,8 @@
 
 #include "ObjectGuid.h"
 
+#define MAX_LOOT_OBJECT_COUNT 10
+
 class AiObjectContext;
 class Player;
 class WorldObject;
@@ -57,6 +59,13 @@ public:
 public:
     ObjectGuid guid;
     time_t asOfTime;
+
+    // cached loot feasibility, not part of the ordering
+    mutable LootObject loot;
+    mutable bool lootChecked;
+    mutable bool lootPossible;
+    mutable uint32 inventoryVersion;
+    mutable uint32 checkTime;
 };
 
 class LootTargetList : public std::set<LootTarget>
@@ -68,19 +77,34 @@ public:
 class LootObjectStack
 {
 public:
-    LootObjectStack(Player* bot) : bot(bot) {}
+    LootObjectStack(Player* bot) : bot(bot) { candidates.reserve(MAX_LOOT_OBJECT_COUNT); }
 
     bool Add(ObjectGuid guid);
     void Remove(ObjectGuid guid);
     void Clear();
     bool CanLoot(float maxDistance);
     LootObject GetLoot(float maxDistance = 0);
+    bool HasLootTool(uint32 skillId);
 
 private:
-    std::vector<LootObject> OrderByDistance(float maxDistance = 0);
+    struct LootCandidate
+    {
+        float distance;
+        LootTarget const* target;
+
+        bool operator<(LootCandidate const& other) const { return distance > other.distance; }
+    };
+
+    bool IsLootPossible(LootTarget const& target);
+    bool FillCandidates(float maxDistance, bool firstOnly);
 
     Player* bot;
     LootTargetList availableLoot;
+    std::vector<LootCandidate> candidates;
+    uint32 toolsInventoryVersion = 0;
+    bool toolsChecked = false;
+    bool hasMiningPick = false;
+    bool hasSkinningKnife = false;
 };
 
 #endif
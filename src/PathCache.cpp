@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#include "PathCache.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Playerbots.h"
+#include "Timer.h"
+
+// maps nobody asked a path for in this long are dropped
+static constexpr uint32 PATH_CACHE_IDLE_TIME = 60 * IN_MILLISECONDS;
+static constexpr uint32 PATH_CACHE_STATS_INTERVAL = 5 * MINUTE * IN_MILLISECONDS;
+
+enum PathCacheFlags : uint8
+{
+    PATH_CACHE_FORCE_DEST = 0x01,
+    PATH_CACHE_FLYING = 0x02,
+    PATH_CACHE_SWIMMING = 0x04,
+    PATH_CACHE_PLAYER = 0x08
+};
+
+bool PathCache::Key::operator==(Key const& other) const
+{
+    return flags == other.flags && std::equal(start, start + 3, other.start) && std::equal(end, end + 3, other.end);
+}
+
+size_t PathCache::KeyHash::operator()(Key const& key) const
+{
+    size_t hash = key.flags;
+    for (uint8 i = 0; i < 3; ++i)
+    {
+        hash = hash * 31 + std::hash<int32>()(key.start[i]);
+        hash = hash * 31 + std::hash<int32>()(key.end[i]);
+    }
+
+    return hash;
+}
+
+std::shared_ptr<PathCache::MapPaths> PathCache::GetMapPaths(uint32 mapId, uint32 instanceId)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    std::shared_ptr<MapPaths>& paths = maps[(uint64(mapId) << 32) | instanceId];
+    if (!paths)
+        paths = std::make_shared<MapPaths>();
+
+    return paths;
+}
+
+static void SolvePath(Unit* mover, float x, float y, float z, bool forceDest, CachedPath& result)
+{
+    PathGenerator path(mover);
+    path.CalculatePath(x, y, z, forceDest);
+    result.points = path.GetPath();
+    result.actualEnd = path.GetActualEndPosition();
+    result.type = path.GetPathType();
+    result.length = path.getPathLength();
+}
+
+void PathCache::CalculatePath(Unit* mover, float x, float y, float z, bool forceDest, CachedPath& result)
+{
+    uint32 const maxSize = sPlayerbotAIConfig->pathCacheSize;
+    if (!maxSize)
+    {
+        SolvePath(mover, x, y, z, forceDest, result);
+        return;
+    }
+
+    float const grid = sPlayerbotAIConfig->pathCacheGridSize;
+    Key key;
+    key.start[0] = int32(std::floor(mover->GetPositionX() / grid));
+    key.start[1] = int32(std::floor(mover->GetPositionY() / grid));
+    key.start[2] = int32(std::floor(mover->GetPositionZ() / grid));
+    key.end[0] = int32(std::floor(x / grid));
+    key.end[1] = int32(std::floor(y / grid));
+    key.end[2] = int32(std::floor(z / grid));
+    key.flags = (forceDest ? PATH_CACHE_FORCE_DEST : 0) | (mover->IsFlying() ? PATH_CACHE_FLYING : 0) |
+                (mover->IsInWater() ? PATH_CACHE_SWIMMING : 0) |
+                (mover->GetTypeId() == TYPEID_PLAYER ? PATH_CACHE_PLAYER : 0);
+
+    std::shared_ptr<MapPaths> paths = GetMapPaths(mover->GetMapId(), mover->GetInstanceId());
+    uint32 const now = getMSTime();
+    paths->lastAccess = now;
+    {
+        std::lock_guard<std::mutex> guard(paths->lock);
+        auto i = paths->index.find(key);
+        if (i != paths->index.end())
+        {
+            if (getMSTimeDiff(i->second->time, now) < sPlayerbotAIConfig->pathCacheTime)
+            {
+                paths->lru.splice(paths->lru.begin(), paths->lru, i->second);
+                result = i->second->path;
+                ++hits;
+                return;
+            }
+
+            paths->lru.erase(i->second);
+            paths->index.erase(i);
+        }
+    }
+
+    ++misses;
+    SolvePath(mover, x, y, z, forceDest, result);
+
+    std::lock_guard<std::mutex> guard(paths->lock);
+    if (paths->index.find(key) != paths->index.end())
+        return;
+
+    paths->lru.push_front({key, now, result});
+    paths->index[key] = paths->lru.begin();
+    while (paths->lru.size() > maxSize)
+    {
+        paths->index.erase(paths->lru.back().key);
+        paths->lru.pop_back();
+    }
+}
+
+void PathCache::Update()
+{
+    uint32 const now = getMSTime();
+    size_t mapCount = 0;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        for (auto i = maps.begin(); i != maps.end();)
+        {
+            // lastAccess may be a bit ahead of now when a map thread just used it
+            if (int32(now - i->second->lastAccess) > int32(PATH_CACHE_IDLE_TIME))
+                i = maps.erase(i);
+            else
+                ++i;
+        }
+
+        mapCount = maps.size();
+    }
+
+    if (getMSTimeDiff(lastStatsTime, now) < PATH_CACHE_STATS_INTERVAL)
+        return;
+
+    lastStatsTime = now;
+    uint32 hitCount = hits.exchange(0);
+    uint32 missCount = misses.exchange(0);
+    if (hitCount + missCount)
+        LOG_DEBUG("playerbots", "Path cache: {} hits, {} misses ({}% hit rate), {} maps", hitCount, missCount,
+                  hitCount * 100 / (hitCount + missCount), mapCount);
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#ifndef _PLAYERBOT_PATHCACHE_H
+#define _PLAYERBOT_PATHCACHE_H
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "Common.h"
+#include "PathGenerator.h"
+
+class Unit;
+
+struct CachedPath
+{
+    Movement::PointsArray points;
+    G3D::Vector3 actualEnd;
+    PathType type = PATHFIND_BLANK;
+    float length = 0.0f;
+};
+
+// Recent PathGenerator results shared by all bots, one LRU list per map instance. Start and end points are
+// quantized so bots standing next to each other reuse the path one of them just solved. Instances get their own
+// list, so a reset instance never sees paths of its predecessor.
+class PathCache
+{
+public:
+    PathCache() {}
+    virtual ~PathCache() {}
+    static PathCache* instance()
+    {
+        static PathCache instance;
+        return &instance;
+    }
+
+    void CalculatePath(Unit* mover, float x, float y, float z, bool forceDest, CachedPath& result);
+    // Drops idle maps and logs hit rate, world thread only
+    void Update();
+
+private:
+    struct Key
+    {
+        int32 start[3];
+        int32 end[3];
+        uint8 flags;
+
+        bool operator==(Key const& other) const;
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(Key const& key) const;
+    };
+
+    struct Entry
+    {
+        Key key;
+        uint32 time;
+        CachedPath path;
+    };
+
+    struct MapPaths
+    {
+        std::mutex lock;
+        std::list<Entry> lru;
+        std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index;
+        std::atomic<uint32> lastAccess{0};
+    };
+
+    std::shared_ptr<MapPaths> GetMapPaths(uint32 mapId, uint32 instanceId);
+
+    std::mutex lock;
+    std::unordered_map<uint64, std::shared_ptr<MapPaths>> maps;
+    std::atomic<uint32> hits{0};
+    std::atomic<uint32> misses{0};
+    uint32 lastStatsTime = 0;
+};
+
+#define sPathCache PathCache::instance()
+
+#endif
@@ -5,7 +5,12 @@
 
 #include "PerformanceMonitor.h"
 
+#include "Config.h"
 #include "Playerbots.h"
+#include "Timer.h"
+
+// fixed name, the benchmark writes without the AllowedLogFiles check
+#define PERF_MON_BENCHMARK_FILE "playerbots_perf.csv"
 
 PerformanceMonitorOperation* PerformanceMonitor::start(PerformanceMetric metric, std::string const name,
                                                        PerformanceStack* stack)
@@ -265,6 +270,119 @@ void PerformanceMonitor::Reset()
     }
 }
 
+void PerformanceMonitor::StartBenchmark(uint32 durationMs)
+{
+    if (!benchmarkDuration)
+        benchmarkWasEnabled = sPlayerbotAIConfig->perfMonEnabled;
+
+    Reset();
+    sPlayerbotAIConfig->perfMonEnabled = true;
+    benchmarkStart = getMSTime();
+    benchmarkDuration = std::max(durationMs, 1u);
+
+    LOG_INFO("playerbots", "Performance benchmark started for {} ms, results go to {}", benchmarkDuration,
+             PERF_MON_BENCHMARK_FILE);
+}
+
+void PerformanceMonitor::Update()
+{
+    if (!benchmarkDuration || getMSTimeDiff(benchmarkStart, getMSTime()) < benchmarkDuration)
+        return;
+
+    sPlayerbotAIConfig->perfMonEnabled = benchmarkWasEnabled;
+    benchmarkDuration = 0;
+
+    if (WriteCsv())
+        LOG_INFO("playerbots", "Performance benchmark finished, results written to {}", PERF_MON_BENCHMARK_FILE);
+}
+
+bool PerformanceMonitor::WriteCsv()
+{
+    struct Totals
+    {
+        uint64 minTime = 0;
+        uint64 maxTime = 0;
+        uint64 totalTime = 0;
+        uint32 count = 0;
+    };
+
+    // Same names called from different parents are summed up, ordered by type and name to keep files diffable
+    std::map<std::pair<PerformanceMetric, std::string>, Totals> rows;
+    uint32 ticks = 0;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        for (auto const& [metric, pdMap] : data)
+        {
+            for (auto const& [stackName, pd] : pdMap)
+            {
+                std::lock_guard<std::mutex> pdGuard(pd->lock);
+                if (metric == PERF_MON_TOTAL && stackName == "PlayerbotAIBase::FullTick")
+                    ticks = pd->count;
+
+                if (!pd->count)
+                    continue;
+
+                Totals& totals = rows[std::make_pair(metric, stackName.substr(0, stackName.find(" [")))];
+                if (pd->minTime && (!totals.minTime || totals.minTime > pd->minTime))
+                    totals.minTime = pd->minTime;
+
+                totals.maxTime = std::max(totals.maxTime, pd->maxTime);
+                totals.totalTime += pd->totalTime;
+                totals.count += pd->count;
+            }
+        }
+    }
+
+    // Written directly instead of through openLog, so it does not need to be listed in AllowedLogFiles
+    std::string const fileName = PERF_MON_BENCHMARK_FILE;
+    std::string logsDir = sConfigMgr->GetOption<std::string>("LogsDir", "", false);
+    if (!logsDir.empty() && logsDir.back() != '/' && logsDir.back() != '\\')
+        logsDir.append("/");
+
+    FILE* file = fopen((logsDir + fileName).c_str(), "w");
+    if (!file)
+    {
+        LOG_ERROR("playerbots", "Performance benchmark finished, but {} could not be opened for writing",
+                  logsDir + fileName);
+        return false;
+    }
+
+    fprintf(file, "type,name,count,per_tick,total_us,min_us,max_us,avg_us\n");
+    for (auto const& [key, totals] : rows)
+    {
+        char const* type = "?";
+        switch (key.first)
+        {
+            case PERF_MON_TRIGGER:
+                type = "Trigger";
+                break;
+            case PERF_MON_VALUE:
+                type = "Value";
+                break;
+            case PERF_MON_ACTION:
+                type = "Action";
+                break;
+            case PERF_MON_RNDBOT:
+                type = "RndBot";
+                break;
+            case PERF_MON_TOTAL:
+                type = "Total";
+                break;
+            default:
+                break;
+        }
+
+        float perTick = ticks ? (float)totals.count / ticks : 0.0f;
+        float avg = (float)totals.totalTime / totals.count;
+        fprintf(file, "%s,\"%s\",%u,%.3f,%llu,%llu,%llu,%.3f\n", type, key.second.c_str(), totals.count, perTick,
+                (unsigned long long)totals.totalTime, (unsigned long long)totals.minTime,
+                (unsigned long long)totals.maxTime, avg);
+    }
+
+    fclose(file);
+    return true;
+}
+
 PerformanceMonitorOperation::PerformanceMonitorOperation(PerformanceData* data, std::string const name,
                                                          PerformanceStack* stack)
     : data(data), name(name), stack(stack)
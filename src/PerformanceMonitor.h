@@ -63,10 +63,19 @@ public:
                                        PerformanceStack* stack = nullptr);
     void PrintStats(bool perTick = false, bool fullStack = false);
     void Reset();
+    // Resets the counters and records for durationMs, then writes one csv line per trigger, value and action to
+    // playerbots_perf.csv in the logs directory so runs of different builds can be diffed
+    void StartBenchmark(uint32 durationMs);
+    void Update();
 
 private:
+    bool WriteCsv();
+
     std::map<PerformanceMetric, std::map<std::string, PerformanceData*> > data;
     std::mutex lock;
+    uint32 benchmarkStart = 0;
+    uint32 benchmarkDuration = 0;
+    bool benchmarkWasEnabled = false;
 };
 
 #define sPerformanceMonitor PerformanceMonitor::instance()
@@ -5,6 +5,7 @@
 
 #include "PlayerbotAI.h"
 
+#include <algorithm>
 #include <cmath>
 #include <mutex>
 #include <sstream>
@@ -14,6 +15,7 @@
 #include "BudgetValues.h"
 #include "ChannelMgr.h"
 #include "CharacterPackets.h"
+#include "ChatDispatcher.h"
 #include "CreatureAIImpl.h"
 #include "EmoteAction.h"
 #include "Engine.h"
@@ -48,6 +50,7 @@
 #include "SocialMgr.h"
 #include "SpellAuraEffects.h"
 #include "SpellInfo.h"
+#include "SpellNameIndex.h"
 #include "Transport.h"
 #include "Unit.h"
 #include "UpdateTime.h"
@@ -74,7 +77,12 @@ uint32 PlayerbotChatHandler::extractQuestId(std::string const str)
     return cId ? atol(cId) : 0;
 }
 
-void PacketHandlingHelper::AddHandler(uint16 opcode, std::string const handler) { handlers[opcode] = handler; }
+void PacketHandlingHelper::AddHandler(uint16 opcode, std::string const handler)
+{
+    handlers[opcode] = handler;
+    if (opcode < handled.size())
+        handled.set(opcode);
+}
 
 void PacketHandlingHelper::Handle(ExternalEventHelper& helper)
 {
@@ -87,13 +95,20 @@ void PacketHandlingHelper::Handle(ExternalEventHelper& helper)
 
 void PacketHandlingHelper::AddPacket(WorldPacket const& packet)
 {
-    if (packet.empty())
+    std::shared_ptr<WorldPacket const> shared;
+    AddPacket(packet, shared);
+}
+
+void PacketHandlingHelper::AddPacket(WorldPacket const& packet, std::shared_ptr<WorldPacket const>& shared)
+{
+    // unhandled opcodes are dropped before anything is copied
+    if (!HasHandler(packet.GetOpcode()) || packet.empty())
         return;
-    // assert(handlers);
-    // assert(packet);
-    // assert(packet.GetOpcode());
-    if (handlers.find(packet.GetOpcode()) != handlers.end())
-        queue.push(WorldPacket(packet));
+
+    if (!shared)
+        shared = std::make_shared<WorldPacket const>(packet);
+
+    queue.push(shared);
 }
 
 PlayerbotAI::PlayerbotAI()
@@ -420,7 +435,7 @@ void PlayerbotAI::UpdateAIInternal([[maybe_unused]] uint32 elapsed, bool minimal
             continue;
         }
 
-        ChatReplyAction::ChatReplyDo(bot, it->m_type, it->m_guid1, it->m_guid2, it->m_msg, it->m_chanName, it->m_name);
+        ChatReplyAction::ChatReplyDo(bot, *it->m_message);
         it = chatReplies.erase(it);
     }
 
@@ -997,118 +1012,89 @@ void PlayerbotAI::HandleBotOutgoingPacket(WorldPacket const& packet)
             if (!AllowActivity())
                 return;
 
-            WorldPacket p(packet);
-            if (!p.empty() && (p.GetOpcode() == SMSG_MESSAGECHAT || p.GetOpcode() == SMSG_GM_MESSAGECHAT))
+            // parsed once and shared by every bot hearing the same message
+            ParsedChatMessagePtr parsed = sChatDispatcher->Parse(packet);
+            if (!parsed || parsed->noReply)
+                return;
+
+            // do not reply to self but always try to reply to real player
+            if (parsed->sender == bot->GetGUID())
+                return;
+
+            time_t lastChat = GetAiObjectContext()->GetValue<time_t>("last said", "chat")->Get();
+            bool isPaused = time(0) < lastChat;
+            bool isFromFreeBot = parsed->fromFreeBot;
+            bool isMentioned = parsed->message.find(bot->GetName()) != std::string::npos;
+
+            // random bot speaks, chat CD
+            if (isFromFreeBot && isPaused)
+                return;
+
+            // BG: react only if mentioned or if not channel and real player spoke
+            if (bot->InBattleground() && !(isMentioned || (parsed->type != CHAT_MSG_CHANNEL && !isFromFreeBot)))
+                return;
+
+            if (HasRealPlayerMaster() && parsed->sender != GetMaster()->GetGUID())
+                return;
+            if (parsed->lang == LANG_ADDON)
+                return;
+
+            if (parsed->toxicLinks && sPlayerbotAIConfig->toxicLinksRepliesChance)
             {
-                p.rpos(0);
-                uint8 msgtype, chatTag;
-                uint32 lang, textLen, nameLen, unused;
-                ObjectGuid guid1, guid2;
-                std::string name = "";
-                std::string chanName = "";
-                std::string message = "";
-
-                p >> msgtype >> lang;
-                p >> guid1 >> unused;
-                if (guid1.IsEmpty() || p.size() > p.DEFAULT_SIZE)
+                if (urand(0, 50) > 0 || urand(1, 100) > sPlayerbotAIConfig->toxicLinksRepliesChance)
+                {
                     return;
-
-                if (p.GetOpcode() == SMSG_GM_MESSAGECHAT)
+                }
+            }
+            else if (parsed->thunderfury && sPlayerbotAIConfig->thunderfuryRepliesChance)
+            {
+                if (urand(0, 60) > 0 || urand(1, 100) > sPlayerbotAIConfig->thunderfuryRepliesChance)
                 {
-                    p >> textLen;
-                    p >> name;
+                    return;
                 }
+            }
+            else
+            {
+                if (isFromFreeBot && urand(0, 20))
+                    return;
+
+                // if (msgtype == CHAT_MSG_GUILD && (!sPlayerbotAIConfig->guildRepliesRate || urand(1, 100) >=
+                // sPlayerbotAIConfig->guildRepliesRate)) return;
 
-                switch (msgtype)
+                if (!isFromFreeBot)
                 {
-                    case CHAT_MSG_CHANNEL:
-                        p >> chanName;
-                        [[fallthrough]];
-                    case CHAT_MSG_SAY:
-                    case CHAT_MSG_PARTY:
-                    case CHAT_MSG_YELL:
-                    case CHAT_MSG_WHISPER:
-                    case CHAT_MSG_GUILD:
-                        p >> guid2;
-                        p >> textLen >> message >> chatTag;
-                        break;
-                    default:
+                    if (!isMentioned && urand(0, 4))
                         return;
                 }
-
-                // do not reply to self but always try to reply to real player
-                if (guid1 != bot->GetGUID())
+                else
                 {
-                    time_t lastChat = GetAiObjectContext()->GetValue<time_t>("last said", "chat")->Get();
-                    bool isPaused = time(0) < lastChat;
-                    bool shouldReply = false;
-                    bool isFromFreeBot = false;
-                    sCharacterCache->GetCharacterNameByGuid(guid1, name);
-                    uint32 accountId = sCharacterCache->GetCharacterAccountIdByGuid(guid1);
-                    isFromFreeBot = sPlayerbotAIConfig->IsInRandomAccountList(accountId);
-                    bool isMentioned = message.find(bot->GetName()) != std::string::npos;
-
-                    ChatChannelSource chatChannelSource = GetChatChannelSource(bot, msgtype, chanName);
-
-                    // random bot speaks, chat CD
-                    if (isFromFreeBot && isPaused)
-                        return;
-
-                    // BG: react only if mentioned or if not channel and real player spoke
-                    if (bot->InBattleground() && !(isMentioned || (msgtype != CHAT_MSG_CHANNEL && !isFromFreeBot)))
+                    if (urand(0, 20 + 10 * isMentioned))
                         return;
+                }
+            }
 
-                    if (HasRealPlayerMaster() && guid1 != GetMaster()->GetGUID())
-                        return;
-                    if (lang == LANG_ADDON)
-                        return;
+            // bots addressed by name always answer, the rest compete for a few reply slots
+            if (!isMentioned && !sChatDispatcher->ClaimResponder(parsed))
+                return;
 
-                    if (message.starts_with(sPlayerbotAIConfig->toxicLinksPrefix) &&
-                        (GetChatHelper()->ExtractAllItemIds(message).size() > 0 ||
-                         GetChatHelper()->ExtractAllQuestIds(message).size() > 0) &&
-                        sPlayerbotAIConfig->toxicLinksRepliesChance)
-                    {
-                        if (urand(0, 50) > 0 || urand(1, 100) > sPlayerbotAIConfig->toxicLinksRepliesChance)
-                        {
-                            return;
-                        }
-                    }
-                    else if ((GetChatHelper()->ExtractAllItemIds(message).count(19019) &&
-                              sPlayerbotAIConfig->thunderfuryRepliesChance))
-                    {
-                        if (urand(0, 60) > 0 || urand(1, 100) > sPlayerbotAIConfig->thunderfuryRepliesChance)
-                        {
-                            return;
-                        }
-                    }
-                    else
-                    {
-                        if (isFromFreeBot && urand(0, 20))
-                            return;
-
-                        // if (msgtype == CHAT_MSG_GUILD && (!sPlayerbotAIConfig->guildRepliesRate || urand(1, 100) >=
-                        // sPlayerbotAIConfig->guildRepliesRate)) return;
-
-                        if (!isFromFreeBot)
-                        {
-                            if (!isMentioned && urand(0, 4))
-                                return;
-                        }
-                        else
-                        {
-                            if (urand(0, 20 + 10 * isMentioned))
-                                return;
-                        }
-                    }
+            QueueChatResponse(ChatQueuedReply(parsed, time(nullptr) + urand(inCombat ? 10 : 5, inCombat ? 25 : 15)));
+            GetAiObjectContext()->GetValue<time_t>("last said", "chat")->Set(time(0) + urand(5, 25));
+            return;
+        }
+        case SMSG_ITEM_PUSH_RESULT:  // track own inventory changes
+        {
+            if (packet.size() >= sizeof(uint64) && ObjectGuid(packet.read<uint64>(0)) == bot->GetGUID())
+                InventoryChanged();
 
-                    QueueChatResponse(
-                        std::move(ChatQueuedReply{msgtype, guid1.GetCounter(), guid2.GetCounter(), message, chanName,
-                                                  name, time(nullptr) + urand(inCombat ? 10 : 5, inCombat ? 25 : 15)}));
-                    GetAiObjectContext()->GetValue<time_t>("last said", "chat")->Set(time(0) + urand(5, 25));
-                    return;
-                }
-            }
+            botOutgoingPacketHandlers.AddPacket(packet);
+            return;
+        }
+        case SMSG_DESTROY_OBJECT:  // items leaving the inventory are destroyed for the owner
+        {
+            if (packet.size() >= sizeof(uint64) && ObjectGuid(packet.read<uint64>(0)).IsItem())
+                InventoryChanged();
 
+            botOutgoingPacketHandlers.AddPacket(packet);
             return;
         }
         case SMSG_MOVE_KNOCK_BACK:  // handle knockbacks
@@ -1222,11 +1208,21 @@ void PlayerbotAI::HandleMasterIncomingPacket(WorldPacket const& packet)
     masterIncomingPacketHandlers.AddPacket(packet);
 }
 
+void PlayerbotAI::HandleMasterIncomingPacket(WorldPacket const& packet, std::shared_ptr<WorldPacket const>& shared)
+{
+    masterIncomingPacketHandlers.AddPacket(packet, shared);
+}
+
 void PlayerbotAI::HandleMasterOutgoingPacket(WorldPacket const& packet)
 {
     masterOutgoingPacketHandlers.AddPacket(packet);
 }
 
+void PlayerbotAI::HandleMasterOutgoingPacket(WorldPacket const& packet, std::shared_ptr<WorldPacket const>& shared)
+{
+    masterOutgoingPacketHandlers.AddPacket(packet, shared);
+}
+
 void PlayerbotAI::ChangeEngine(BotState type)
 {
     Engine* engine = engines[type];
@@ -1649,6 +1645,8 @@ bool PlayerbotAI::ContainsStrategy(StrategyType type)
 
 bool PlayerbotAI::HasStrategy(std::string const name, BotState type) { return engines[type]->HasStrategy(name); }
 
+bool PlayerbotAI::HasDebugStrategy() { return engines[BOT_STATE_NON_COMBAT]->HasDebugStrategy(); }
+
 void PlayerbotAI::ResetStrategies(bool load)
 {
     for (uint8 i = 0; i < BOT_STATE_MAX; i++)
@@ -2070,29 +2068,28 @@ bool PlayerbotAI::IsMainTank(Player* player)
     {
         return false;
     }
-    ObjectGuid mainTank = ObjectGuid();
+    return player->GetGUID() == GetGroupMainTank(group);
+}
+
+ObjectGuid PlayerbotAI::GetGroupMainTank(Group* group)
+{
     Group::MemberSlotList const& slots = group->GetMemberSlots();
     for (Group::member_citerator itr = slots.begin(); itr != slots.end(); ++itr)
     {
         if (itr->flags & MEMBER_FLAG_MAINTANK)
         {
-            mainTank = itr->guid;
-            break;
+            return itr->guid;
         }
     }
-    if (mainTank != ObjectGuid::Empty)
-    {
-        return player->GetGUID() == mainTank;
-    }
     for (GroupReference* ref = group->GetFirstMember(); ref; ref = ref->next())
     {
         Player* member = ref->GetSource();
         if (IsTank(member) && member->IsAlive())
         {
-            return player->GetGUID() == member->GetGUID();
+            return member->GetGUID();
         }
     }
-    return false;
+    return ObjectGuid::Empty;
 }
 
 uint32 PlayerbotAI::GetGroupTankNum(Player* player)
@@ -2123,12 +2120,13 @@ bool PlayerbotAI::IsAssistTankOfIndex(Player* player, int index)
     {
         return false;
     }
-    Group::MemberSlotList const& slots = group->GetMemberSlots();
+    // resolve the main tank once instead of once per member
+    ObjectGuid mainTank = GetGroupMainTank(group);
     int counter = 0;
     for (GroupReference* ref = group->GetFirstMember(); ref; ref = ref->next())
     {
         Player* member = ref->GetSource();
-        if (group->IsAssistant(member->GetGUID()) && IsAssistTank(member))
+        if (group->IsAssistant(member->GetGUID()) && member->GetGUID() != mainTank && IsTank(member))
         {
             if (index == counter)
             {
@@ -2141,7 +2139,7 @@ bool PlayerbotAI::IsAssistTankOfIndex(Player* player, int index)
     for (GroupReference* ref = group->GetFirstMember(); ref; ref = ref->next())
     {
         Player* member = ref->GetSource();
-        if (!group->IsAssistant(member->GetGUID()) && IsAssistTank(member))
+        if (!group->IsAssistant(member->GetGUID()) && member->GetGUID() != mainTank && IsTank(member))
         {
             if (index == counter)
             {
@@ -2368,57 +2366,57 @@ bool PlayerbotAI::SayToWorld(const std::string& msg)
 
 bool PlayerbotAI::SayToChannel(const std::string& msg, const ChatChannelId& chanId)
 {
-    // Checks whether the message or ChannelMgr is valid
     if (msg.empty())
         return false;
 
+    Channel* channel = GetZoneChannel(chanId);
+    if (!channel)
+        return false;
+
+    channel->Say(bot->GetGUID(), msg.c_str(), LANG_UNIVERSAL);
+    return true;
+}
+
+Channel* PlayerbotAI::GetZoneChannel(ChatChannelId chanId)
+{
+    // Channels only exist once a player has joined them, so a miss is retried after a while
+    if (bot->GetZoneId() != zoneChannelsZoneId ||
+        (zoneChannels.find(chanId) == zoneChannels.end() && time(nullptr) - zoneChannelsResolveTime >= 60))
+        ResolveZoneChannels();
+
+    auto itr = zoneChannels.find(chanId);
+    return itr != zoneChannels.end() ? itr->second : nullptr;
+}
+
+void PlayerbotAI::ResolveZoneChannels()
+{
+    zoneChannels.clear();
+    zoneChannelsZoneId = bot->GetZoneId();
+    zoneChannelsResolveTime = time(nullptr);
+
     ChannelMgr* cMgr = ChannelMgr::forTeam(bot->GetTeamId());
     if (!cMgr)
-        return false;
+        return;
 
-    AreaTableEntry const* current_zone = GetCurrentZone();
+    AreaTableEntry const* current_zone = sAreaTableStore.LookupEntry(zoneChannelsZoneId);
     if (!current_zone)
-        return false;
-
-    const auto current_str_zone = GetLocalizedAreaName(current_zone);
+        return;
 
-    std::mutex socialMutex;
-    std::lock_guard<std::mutex> lock(socialMutex);  // Blocking for thread safety when accessing SocialMgr
+    std::string const current_str_zone = GetLocalizedAreaName(current_zone);
 
+    // Channels with a DBC id are constant, ChannelMgr never frees them while the world runs
     for (auto const& [key, channel] : cMgr->GetChannels())
     {
-        // Checks if the channel pointer is valid
-        if (!channel)
+        if (!channel || !channel->GetChannelId() || channel->GetName().empty())
             continue;
 
-        // Checks if the channel matches the specified ChatChannelId
-        if (channel->GetChannelId() == chanId)
-        {
-            // If the channel name is empty, skip it to avoid access problems
-            if (channel->GetName().empty())
-                continue;
-
-            // Checks if the channel name contains the current zone
-            const auto does_contains = channel->GetName().find(current_str_zone) != std::string::npos;
-            if (chanId != ChatChannelId::LOOKING_FOR_GROUP && chanId != ChatChannelId::WORLD_DEFENSE && !does_contains)
-            {
-                continue;
-            }
-            else if (chanId == ChatChannelId::LOOKING_FOR_GROUP || chanId == ChatChannelId::WORLD_DEFENSE)
-            {
-                // Here you can add the capital check if necessary
-            }
+        uint32 chanId = channel->GetChannelId();
+        if (chanId != ChatChannelId::LOOKING_FOR_GROUP && chanId != ChatChannelId::WORLD_DEFENSE &&
+            channel->GetName().find(current_str_zone) == std::string::npos)
+            continue;
 
-            // Final check to ensure the channel is correct before trying to say something
-            if (channel)
-            {
-                channel->Say(bot->GetGUID(), msg.c_str(), LANG_UNIVERSAL);
-                return true;
-            }
-        }
+        zoneChannels.emplace(chanId, channel);
     }
-
-    return false;
 }
 
 bool PlayerbotAI::SayToParty(const std::string& msg)
@@ -2623,34 +2621,31 @@ bool PlayerbotAI::HasAura(std::string const name, Unit* unit, bool maxStack, boo
     if (!unit)
         return false;
 
-    std::wstring wnamepart;
-    if (!Utf8toWStr(name, wnamepart))
+    std::vector<uint32> const& spellIds = GetSpellIdsByName(name);
+    if (spellIds.empty())
         return false;
 
-    wstrToLower(wnamepart);
-
     int auraAmount = 0;
 
-    // Iterate through all aura types
-    for (uint32 auraType = SPELL_AURA_BIND_SIGHT; auraType < TOTAL_AURAS; auraType++)
+    // Iterate through the auras applied to the unit, skipping the ones named differently
+    for (auto const& [auraId, aurApp] : unit->GetAppliedAuras())
     {
-        Unit::AuraEffectList const& auras = unit->GetAuraEffectsByType((AuraType)auraType);
-        if (auras.empty())
+        if (!std::binary_search(spellIds.begin(), spellIds.end(), auraId))
+            continue;
+
+        Aura const* aura = aurApp->GetBase();
+        SpellInfo const* spellInfo = aura->GetSpellInfo();
+        if (!spellInfo)
             continue;
 
         // Iterate through each aura effect
-        for (AuraEffect const* aurEff : auras)
+        for (uint8 effIndex = EFFECT_0; effIndex < MAX_SPELL_EFFECTS; ++effIndex)
         {
-            if (!aurEff)
-                continue;
-
-            SpellInfo const* spellInfo = aurEff->GetSpellInfo();
-            if (!spellInfo)
+            if (!aurApp->HasEffect(effIndex))
                 continue;
 
-            // Check if the aura name matches
-            std::string_view const auraName = spellInfo->SpellName[0];
-            if (auraName.empty() || auraName.length() != wnamepart.length() || !Utf8FitTo(auraName, wnamepart))
+            AuraEffect const* aurEff = aura->GetEffect(effIndex);
+            if (!aurEff || aurEff->GetAuraType() == SPELL_AURA_NONE)
                 continue;
 
             // Check if this is a valid aura for the bot
@@ -2661,7 +2656,7 @@ bool PlayerbotAI::HasAura(std::string const name, Unit* unit, bool maxStack, boo
                     continue;
 
                 // Check aura duration if necessary
-                if (checkDuration && aurEff->GetBase()->GetDuration() == -1)
+                if (checkDuration && aura->GetDuration() == -1)
                     continue;
 
                 // Count stacks and charges
@@ -2671,10 +2666,10 @@ bool PlayerbotAI::HasAura(std::string const name, Unit* unit, bool maxStack, boo
                 // Count the aura based on max stack and proc charges
                 if (maxStack)
                 {
-                    if (maxStackAmount && aurEff->GetBase()->GetStackAmount() >= maxStackAmount)
+                    if (maxStackAmount && aura->GetStackAmount() >= maxStackAmount)
                         auraAmount++;
 
-                    if (maxProcCharges && aurEff->GetBase()->GetCharges() >= maxProcCharges)
+                    if (maxProcCharges && aura->GetCharges() >= maxProcCharges)
                         auraAmount++;
                 }
                 else
@@ -2721,25 +2716,23 @@ Aura* PlayerbotAI::GetAura(std::string const name, Unit* unit, bool checkIsOwner
     if (!unit)
         return nullptr;
 
-    std::wstring wnamepart;
-    if (!Utf8toWStr(name, wnamepart))
+    std::vector<uint32> const& spellIds = GetSpellIdsByName(name);
+    if (spellIds.empty())
         return nullptr;
 
-    wstrToLower(wnamepart);
-
-    for (uint32 auraType = SPELL_AURA_BIND_SIGHT; auraType < TOTAL_AURAS; ++auraType)
+    for (auto const& [auraId, aurApp] : unit->GetAppliedAuras())
     {
-        Unit::AuraEffectList const& auras = unit->GetAuraEffectsByType((AuraType)auraType);
-        if (auras.empty())
+        if (!std::binary_search(spellIds.begin(), spellIds.end(), auraId))
             continue;
 
-        for (AuraEffect const* aurEff : auras)
+        Aura* aura = aurApp->GetBase();
+        for (uint8 effIndex = EFFECT_0; effIndex < MAX_SPELL_EFFECTS; ++effIndex)
         {
-            SpellInfo const* spellInfo = aurEff->GetSpellInfo();
-            std::string const& auraName = spellInfo->SpellName[0];
+            if (!aurApp->HasEffect(effIndex))
+                continue;
 
-            // Directly skip if name mismatch (both length and content)
-            if (auraName.empty() || auraName.length() != wnamepart.length() || !Utf8FitTo(auraName, wnamepart))
+            AuraEffect const* aurEff = aura->GetEffect(effIndex);
+            if (!aurEff || aurEff->GetAuraType() == SPELL_AURA_NONE)
                 continue;
 
             if (!IsRealAura(bot, aurEff, unit))
@@ -2750,14 +2743,14 @@ Aura* PlayerbotAI::GetAura(std::string const name, Unit* unit, bool checkIsOwner
                 continue;
 
             // Check duration if necessary
-            if (checkDuration && aurEff->GetBase()->GetDuration() == -1)
+            if (checkDuration && aura->GetDuration() == -1)
                 continue;
 
             // Check stack if necessary
-            if (checkStack != -1 && aurEff->GetBase()->GetStackAmount() < checkStack)
+            if (checkStack != -1 && aura->GetStackAmount() < checkStack)
                 continue;
 
-            return aurEff->GetBase();
+            return aura;
         }
     }
 
@@ -5066,89 +5059,32 @@ std::vector<Item*> PlayerbotAI::GetInventoryItems()
 
 uint32 PlayerbotAI::GetInventoryItemsCountWithId(uint32 itemId)
 {
-    uint32 count = 0;
-
-    for (int i = INVENTORY_SLOT_BAG_START; i < INVENTORY_SLOT_BAG_END; ++i)
-    {
-        if (Bag* pBag = (Bag*)bot->GetItemByPos(INVENTORY_SLOT_BAG_0, i))
-        {
-            for (uint32 j = 0; j < pBag->GetBagSize(); ++j)
-            {
-                if (Item* pItem = pBag->GetItemByPos(j))
-                {
-                    if (pItem->GetTemplate()->ItemId == itemId)
-                    {
-                        count += pItem->GetCount();
-                    }
-                }
-            }
-        }
-    }
+    return GetInventoryIndex().GetItemCount(itemId);
+}
 
-    for (int i = INVENTORY_SLOT_ITEM_START; i < INVENTORY_SLOT_ITEM_END; ++i)
-    {
-        if (Item* pItem = bot->GetItemByPos(INVENTORY_SLOT_BAG_0, i))
-        {
-            if (pItem->GetTemplate()->ItemId == itemId)
-            {
-                count += pItem->GetCount();
-            }
-        }
-    }
+InventoryIndex& PlayerbotAI::GetInventoryIndex()
+{
+    inventoryIndex.Refresh(bot, inventoryVersion);
+    return inventoryIndex;
+}
 
-    for (int i = KEYRING_SLOT_START; i < KEYRING_SLOT_END; ++i)
-    {
-        if (Item* pItem = bot->GetItemByPos(INVENTORY_SLOT_BAG_0, i))
-        {
-            if (pItem->GetTemplate()->ItemId == itemId)
-            {
-                count += pItem->GetCount();
-            }
-        }
-    }
+std::vector<uint32> const& PlayerbotAI::GetSpellIdsByName(std::string const& name)
+{
+    auto itr = spellIdsByName.find(name);
+    if (itr != spellIdsByName.end())
+        return *itr->second;
 
-    return count;
+    std::vector<uint32> const& spellIds = sSpellNameIndex->GetSpellIds(name);
+    spellIdsByName[name] = &spellIds;
+    return spellIds;
 }
 
 bool PlayerbotAI::HasItemInInventory(uint32 itemId)
 {
-    for (int i = INVENTORY_SLOT_BAG_START; i < INVENTORY_SLOT_BAG_END; ++i)
-    {
-        if (Bag* pBag = (Bag*)bot->GetItemByPos(INVENTORY_SLOT_BAG_0, i))
-        {
-            for (uint32 j = 0; j < pBag->GetBagSize(); ++j)
-            {
-                if (Item* pItem = pBag->GetItemByPos(j))
-                {
-                    if (pItem->GetTemplate()->ItemId == itemId)
-                    {
-                        return true;
-                    }
-                }
-            }
-        }
-    }
-
-    for (int i = INVENTORY_SLOT_ITEM_START; i < INVENTORY_SLOT_ITEM_END; ++i)
+    for (Item* item : GetInventoryIndex().GetItems(itemId))
     {
-        if (Item* pItem = bot->GetItemByPos(INVENTORY_SLOT_BAG_0, i))
-        {
-            if (pItem->GetTemplate()->ItemId == itemId)
-            {
-                return true;
-            }
-        }
-    }
-
-    for (int i = KEYRING_SLOT_START; i < KEYRING_SLOT_END; ++i)
-    {
-        if (Item* pItem = bot->GetItemByPos(INVENTORY_SLOT_BAG_0, i))
-        {
-            if (pItem->GetTemplate()->ItemId == itemId)
-            {
-                return true;
-            }
-        }
+        if (!item->IsEquipped())
+            return true;
     }
 
     return false;
@@ -6,14 +6,19 @@
 #ifndef _PLAYERBOT_PLAYERbotAI_H
 #define _PLAYERBOT_PLAYERbotAI_H
 
+#include <bitset>
+#include <memory>
 #include <queue>
 #include <stack>
+#include <unordered_map>
 
 #include "Chat.h"
 #include "ChatFilter.h"
 #include "ChatHelper.h"
 #include "Common.h"
+#include "DecisionTrace.h"
 #include "Event.h"
+#include "InventoryIndex.h"
 #include "Item.h"
 #include "NewRpgStrategy.h"
 #include "PlayerbotAIBase.h"
@@ -25,10 +30,12 @@
 #include "WorldPacket.h"
 
 class AiObjectContext;
+class Channel;
 class Creature;
 class Engine;
 class ExternalEventHelper;
 class Gameobject;
+class Group;
 class Item;
 class ObjectGuid;
 class Player;
@@ -340,11 +347,15 @@ class PacketHandlingHelper
 public:
     void AddHandler(uint16 opcode, std::string const handler);
     void Handle(ExternalEventHelper& helper);
+    bool HasHandler(uint16 opcode) const { return opcode < handled.size() && handled[opcode]; }
     void AddPacket(WorldPacket const& packet);
+    // packets relayed to several bots are copied once, on the first bot that handles them
+    void AddPacket(WorldPacket const& packet, std::shared_ptr<WorldPacket const>& shared);
 
 private:
     std::map<uint16, std::string> handlers;
-    std::stack<WorldPacket> queue;
+    std::bitset<NUM_MSG_TYPES> handled;
+    std::stack<std::shared_ptr<WorldPacket const>> queue;
 };
 
 class ChatCommandHolder
@@ -387,7 +398,9 @@ public:
     void QueueChatResponse(const ChatQueuedReply reply);
     void HandleBotOutgoingPacket(WorldPacket const& packet);
     void HandleMasterIncomingPacket(WorldPacket const& packet);
+    void HandleMasterIncomingPacket(WorldPacket const& packet, std::shared_ptr<WorldPacket const>& shared);
     void HandleMasterOutgoingPacket(WorldPacket const& packet);
+    void HandleMasterOutgoingPacket(WorldPacket const& packet, std::shared_ptr<WorldPacket const>& shared);
     void HandleTeleportAck();
     void ChangeEngine(BotState type);
     void DoNextAction(bool minimal = false);
@@ -412,6 +425,7 @@ public:
     static bool IsCombo(Player* player, bool bySpec = false);
     static bool IsRangedDps(Player* player, bool bySpec = false);
     static bool IsMainTank(Player* player);
+    static ObjectGuid GetGroupMainTank(Group* group);
     static uint32 GetGroupTankNum(Player* player);
     bool IsAssistTank(Player* player);
     bool IsAssistTankOfIndex(Player* player, int index);
@@ -489,6 +503,8 @@ public:
                       Item* itemTarget = nullptr);
 
     bool HasAura(uint32 spellId, Unit const* player);
+    // Every spell id named like this, resolved once per name and kept for the lifetime of the bot
+    std::vector<uint32> const& GetSpellIdsByName(std::string const& name);
     Aura* GetAura(std::string const spellName, Unit* unit, bool checkIsOwner = false, bool checkDuration = false,
                   int checkStack = -1);
     bool CastSpell(uint32 spellId, Unit* target, Item* itemTarget = nullptr);
@@ -565,6 +581,12 @@ public:
     std::vector<Item*> GetInventoryAndEquippedItems();
     std::vector<Item*> GetInventoryItems();
     uint32 GetInventoryItemsCountWithId(uint32 itemId);
+    // Bumped whenever an item is pushed to or destroyed from the bot's inventory.
+    uint32 GetInventoryVersion() const { return inventoryVersion; }
+    void InventoryChanged() { ++inventoryVersion; }
+    InventoryIndex& GetInventoryIndex();
+    DecisionTrace& GetDecisionTrace() { return decisionTrace; }
+    bool HasDebugStrategy();
     bool HasItemInInventory(uint32 itemId);
     std::vector<std::pair<const Quest*, uint32>> GetCurrentQuestsRequiringItemId(uint32 itemId);
     uint32 GetReactDelay();
@@ -587,6 +609,8 @@ private:
     Item* FindItemInInventory(std::function<bool(ItemTemplate const*)> checkItem) const;
     void HandleCommands();
     void HandleCommand(uint32 type, const std::string& text, Player& fromPlayer, const uint32 lang = LANG_UNIVERSAL);
+    Channel* GetZoneChannel(ChatChannelId chanId);
+    void ResolveZoneChannels();
     bool _isBotInitializing = false;
 
 protected:
@@ -614,6 +638,13 @@ protected:
     BotCheatMask cheatMask = BotCheatMask::none;
     Position jumpDestination = Position();
     uint32 nextTransportCheck = 0;
+    uint32 inventoryVersion = 0;
+    InventoryIndex inventoryIndex;
+    std::unordered_map<std::string, std::vector<uint32> const*> spellIdsByName;
+    DecisionTrace decisionTrace;
+    uint32 zoneChannelsZoneId = 0;
+    time_t zoneChannelsResolveTime = 0;
+    std::unordered_map<uint32, Channel*> zoneChannels;
 };
 
 #endif
@@ -8,12 +8,15 @@
 #include <iostream>
 
 #include "Config.h"
+#include "CraftSpellIndex.h"
 #include "PlayerbotDungeonSuggestionMgr.h"
 #include "PlayerbotFactory.h"
 #include "Playerbots.h"
+#include "QuestIndex.h"
 #include "RandomItemMgr.h"
 #include "RandomPlayerbotFactory.h"
 #include "RandomPlayerbotMgr.h"
+#include "SpellNameIndex.h"
 #include "Talentspec.h"
 
 template <class T>
@@ -71,6 +74,9 @@ bool PlayerbotAIConfig::Initialize()
     maxWaitForMove = sConfigMgr->GetOption<int32>("AiPlayerbot.MaxWaitForMove", 5000);
     disableMoveSplinePath = sConfigMgr->GetOption<int32>("AiPlayerbot.DisableMoveSplinePath", 0);
     maxMovementSearchTime = sConfigMgr->GetOption<int32>("AiPlayerbot.MaxMovementSearchTime", 3);
+    pathCacheSize = sConfigMgr->GetOption<int32>("AiPlayerbot.PathCacheSize", 512);
+    pathCacheTime = sConfigMgr->GetOption<int32>("AiPlayerbot.PathCacheTime", 5000);
+    pathCacheGridSize = std::max(0.1f, sConfigMgr->GetOption<float>("AiPlayerbot.PathCacheGridSize", 1.0f));
     expireActionTime = sConfigMgr->GetOption<int32>("AiPlayerbot.ExpireActionTime", 5000);
     dispelAuraDuration = sConfigMgr->GetOption<int32>("AiPlayerbot.DispelAuraDuration", 7000);
     reactDelay = sConfigMgr->GetOption<int32>("AiPlayerbot.ReactDelay", 100);
@@ -177,6 +183,8 @@ bool PlayerbotAIConfig::Initialize()
         sConfigMgr->GetOption<int32>("AiPlayerbot.RandomBotInWorldWithRotationDisabled", 1 * YEAR);
     randomBotTeleportDistance = sConfigMgr->GetOption<int32>("AiPlayerbot.RandomBotTeleportDistance", 100);
     randomBotsPerInterval = sConfigMgr->GetOption<int32>("AiPlayerbot.RandomBotsPerInterval", 60);
+    maxConcurrentBotLogins = sConfigMgr->GetOption<int32>("AiPlayerbot.MaxConcurrentBotLogins", 60);
+    botLoginsPerUpdate = sConfigMgr->GetOption<int32>("AiPlayerbot.BotLoginsPerUpdate", 10);
     minRandomBotsPriceChangeInterval =
         sConfigMgr->GetOption<int32>("AiPlayerbot.MinRandomBotsPriceChangeInterval", 2 * HOUR);
     maxRandomBotsPriceChangeInterval =
@@ -270,6 +278,7 @@ bool PlayerbotAIConfig::Initialize()
 
     toxicLinksRepliesChance = sConfigMgr->GetOption<int32>("AiPlayerbot.ToxicLinksRepliesChance", 30);    // 0-100
     thunderfuryRepliesChance = sConfigMgr->GetOption<int32>("AiPlayerbot.ThunderfuryRepliesChance", 40);  // 0-100
+    maxChatRespondersPerMessage = sConfigMgr->GetOption<int32>("AiPlayerbot.MaxChatRespondersPerMessage", 5);
     guildRepliesRate = sConfigMgr->GetOption<int32>("AiPlayerbot.GuildRepliesRate", 100);                 // 0-100
     suggestDungeonsInLowerCaseRandomly =
         sConfigMgr->GetOption<bool>("AiPlayerbot.SuggestDungeonsInLowerCaseRandomly", false);
@@ -558,6 +567,9 @@ bool PlayerbotAIConfig::Initialize()
     sPlayerbotTextMgr->LoadBotTexts();
     sPlayerbotTextMgr->LoadBotTextChance();
     PlayerbotFactory::Init();
+    sCraftSpellIndex->Init();
+    sSpellNameIndex->Init();
+    sQuestIndex->Init();
 
     if (!sPlayerbotAIConfig->autoDoQuests)
     {
@@ -60,6 +60,8 @@ public:
     uint32 globalCoolDown, reactDelay, maxWaitForMove, disableMoveSplinePath, maxMovementSearchTime, expireActionTime,
         dispelAuraDuration, passiveDelay, repeatDelay, errorDelay, rpgDelay, sitDelay, returnDelay, lootDelay;
     bool dynamicReactDelay;
+    uint32 pathCacheSize, pathCacheTime;
+    float pathCacheGridSize;
     float sightDistance, spellDistance, reactDistance, grindDistance, lootDistance, shootDistance, fleeDistance,
         tooCloseDistance, meleeDistance, followDistance, whisperDistance, contactDistance, aoeRadius, rpgDistance,
         targetPosRecalcDistance, farDistance, healDistance, aggroDistance;
@@ -98,6 +100,7 @@ public:
     uint32 randomBotInWorldWithRotationDisabled;
     uint32 minRandomBotPvpTime, maxRandomBotPvpTime;
     uint32 randomBotsPerInterval;
+    uint32 maxConcurrentBotLogins, botLoginsPerUpdate;
     uint32 minRandomBotsPriceChangeInterval, maxRandomBotsPriceChangeInterval;
     bool randomBotJoinLfg;
 
@@ -163,6 +166,7 @@ public:
 
     uint32 broadcastChanceSuggestThunderfury;
     uint32 thunderfuryRepliesChance;
+    uint32 maxChatRespondersPerMessage;
 
     uint32 broadcastChanceGuildManagement;
 
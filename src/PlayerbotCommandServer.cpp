@@ -6,68 +6,96 @@
 #include "PlayerbotCommandServer.h"
 
 #include <boost/asio.hpp>
-#include <boost/bind.hpp>
-#include <boost/smart_ptr.hpp>
-#include <boost/thread/thread.hpp>
-#include <cstdlib>
-#include <iostream>
+#include <deque>
+#include <istream>
 
 #include "IoContext.h"
 #include "Playerbots.h"
 
 using boost::asio::ip::tcp;
-typedef boost::shared_ptr<tcp::socket> socket_ptr;
 
-bool ReadLine(socket_ptr sock, std::string* buffer, std::string* line)
+// longest accepted request line, batch requests with a few thousand guids still fit
+static constexpr size_t MAX_COMMAND_LINE_SIZE = 64 * 1024;
+
+// One client connection. Reads and writes run on the server thread only, so requests are answered in order and
+// a client may pipeline any number of lines without waiting for replies.
+class PlayerbotCommandSession : public std::enable_shared_from_this<PlayerbotCommandSession>
 {
-    // Do the real reading from fd until buffer has '\n'.
-    std::string::iterator pos;
-    while ((pos = find(buffer->begin(), buffer->end(), '\n')) == buffer->end())
-    {
-        char buf[1025];
-        boost::system::error_code error;
-        size_t n = sock->read_some(boost::asio::buffer(buf), error);
-        if (n == -1 || error == boost::asio::error::eof)
-            return false;
-        else if (error)
-            throw boost::system::system_error(error);  // Some other error.
-
-        buf[n] = 0;
-        *buffer += buf;
-    }
+public:
+    PlayerbotCommandSession(tcp::socket socket) : socket(std::move(socket)), buffer(MAX_COMMAND_LINE_SIZE) {}
 
-    *line = std::string(buffer->begin(), pos);
-    *buffer = std::string(pos + 1, buffer->end());
-    return true;
-}
+    void Start() { Read(); }
 
-void session(socket_ptr sock)
-{
-    try
+    // thread safe, the write is handed over to the server thread
+    void Send(std::string response)
     {
-        std::string buffer, request;
-        while (ReadLine(sock, &buffer, &request))
-        {
-            std::string const response = sRandomPlayerbotMgr->HandleRemoteCommand(request) + "\n";
-            boost::asio::write(*sock, boost::asio::buffer(response.c_str(), response.size()));
-            request = "";
-        }
+        std::shared_ptr<PlayerbotCommandSession> self = shared_from_this();
+        boost::asio::post(socket.get_executor(),
+                          [self, response = std::move(response)]() mutable
+                          {
+                              bool idle = self->writeQueue.empty();
+                              self->writeQueue.push_back(std::move(response));
+                              if (idle)
+                                  self->Write();
+                          });
     }
-    catch (std::exception& e)
+
+private:
+    void Read()
     {
-        LOG_ERROR("playerbots", "{}", e.what());
+        std::shared_ptr<PlayerbotCommandSession> self = shared_from_this();
+        boost::asio::async_read_until(socket, buffer, '\n',
+                                      [self](boost::system::error_code const& error, size_t /*length*/)
+                                      {
+                                          if (error)
+                                              return;
+
+                                          std::istream stream(&self->buffer);
+                                          std::string request;
+                                          std::getline(stream, request);
+                                          if (!request.empty() && request.back() == '\r')
+                                              request.pop_back();
+
+                                          sPlayerbotCommandServer->Enqueue(self, std::move(request));
+                                          self->Read();
+                                      });
     }
-}
 
-void server(Acore::Asio::IoContext& io_service, short port)
-{
-    tcp::acceptor a(io_service, tcp::endpoint(tcp::v4(), port));
-    for (;;)
+    void Write()
     {
-        socket_ptr sock(new tcp::socket(io_service));
-        a.accept(*sock);
-        boost::thread t(boost::bind(session, sock));
+        std::shared_ptr<PlayerbotCommandSession> self = shared_from_this();
+        boost::asio::async_write(socket, boost::asio::buffer(writeQueue.front()),
+                                 [self](boost::system::error_code const& error, size_t /*length*/)
+                                 {
+                                     if (error)
+                                     {
+                                         self->writeQueue.clear();
+                                         return;
+                                     }
+
+                                     self->writeQueue.pop_front();
+                                     if (!self->writeQueue.empty())
+                                         self->Write();
+                                 });
     }
+
+    tcp::socket socket;
+    boost::asio::streambuf buffer;
+    std::deque<std::string> writeQueue;
+};
+
+static void Accept(tcp::acceptor& acceptor)
+{
+    acceptor.async_accept(
+        [&acceptor](boost::system::error_code const& error, tcp::socket socket)
+        {
+            if (!error)
+                std::make_shared<PlayerbotCommandSession>(std::move(socket))->Start();
+            else
+                LOG_ERROR("playerbots", "Command server accept failed: {}", error.message());
+
+            Accept(acceptor);
+        });
 }
 
 void Run()
@@ -84,7 +112,9 @@ void Run()
     try
     {
         Acore::Asio::IoContext io_service;
-        server(io_service, sPlayerbotAIConfig->commandServerPort);
+        tcp::acceptor acceptor(io_service, tcp::endpoint(tcp::v4(), sPlayerbotAIConfig->commandServerPort));
+        Accept(acceptor);
+        io_service.run();
     }
 
     catch (std::exception& e)
@@ -98,3 +128,18 @@ void PlayerbotCommandServer::Start()
     std::thread serverThread(Run);
     serverThread.detach();
 }
+
+void PlayerbotCommandServer::Enqueue(std::shared_ptr<PlayerbotCommandSession> session, std::string request)
+{
+    commands.Enqueue(new PlayerbotCommand{std::move(session), std::move(request)});
+}
+
+void PlayerbotCommandServer::Update()
+{
+    PlayerbotCommand* command = nullptr;
+    while (commands.Dequeue(command))
+    {
+        command->session->Send(sRandomPlayerbotMgr->HandleRemoteCommand(command->request) + "\n");
+        delete command;
+    }
+}
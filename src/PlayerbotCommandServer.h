@@ -6,6 +6,20 @@
 #ifndef _PLAYERBOT_PLAYERBOTCOMMANDSERVER_H
 #define _PLAYERBOT_PLAYERBOTCOMMANDSERVER_H
 
+#include <memory>
+#include <string>
+
+#include "MPSCQueue.h"
+
+class PlayerbotCommandSession;
+
+// Request line read by the network thread, answered on the world thread
+struct PlayerbotCommand
+{
+    std::shared_ptr<PlayerbotCommandSession> session;
+    std::string request;
+};
+
 class PlayerbotCommandServer
 {
 public:
@@ -18,6 +32,12 @@ public:
     }
 
     void Start();
+    // Answers queued requests, world thread only
+    void Update();
+    void Enqueue(std::shared_ptr<PlayerbotCommandSession> session, std::string request);
+
+private:
+    MPSCQueue<PlayerbotCommand> commands;
 };
 
 #define sPlayerbotCommandServer PlayerbotCommandServer::instance()
@@ -8,64 +8,115 @@
 #include <iostream>
 
 #include "Playerbots.h"
+#include "StringFormat.h"
+#include "Timer.h"
+
+#define MAX_DB_STORE_ROWS_PER_INSERT 500
+// prefetches of logins that never reached Load are dropped after this long
+#define DB_STORE_PREFETCH_TIMEOUT (5 * MINUTE * IN_MILLISECONDS)
 
 void PlayerbotDbStore::Load(PlayerbotAI* botAI)
 {
     ObjectGuid::LowType guid = botAI->GetBot()->GetGUID().GetCounter();
 
-    PlayerbotsDatabasePreparedStatement* stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_SEL_DB_STORE);
-    stmt->SetData(0, guid);
-    if (PreparedQueryResult result = PlayerbotsDatabase.Query(stmt))
+    PlayerbotDbStoreRecords records;
+    bool found = false;
     {
-        std::vector<std::string> values;
-        do
+        std::lock_guard<std::mutex> guard(lock);
+
+        // not yet written store is newer than anything in the database
+        std::map<uint32, PlayerbotDbStoreRecords>::iterator dirtyItr = dirty.find(guid);
+        if (dirtyItr != dirty.end())
         {
-            Field* fields = result->Fetch();
-            std::string const key = fields[0].Get<std::string>();
-            std::string const value = fields[1].Get<std::string>();
+            records = dirtyItr->second;
+            found = true;
+        }
 
-            if (key == "value")
-                values.push_back(value);
-            else if (key == "co")
+        // flushed but not committed yet, the database and any prefetch may still hold the old rows
+        auto savingItr = saving.find(guid);
+        if (!found && savingItr != saving.end())
+        {
+            records = savingItr->second.second;
+            found = true;
+        }
+
+        std::map<uint32, PlayerbotDbStorePrefetch>::iterator itr = prefetched.find(guid);
+        if (itr != prefetched.end())
+        {
+            if (!found && itr->second.ready)
             {
-                botAI->ClearStrategies(BOT_STATE_COMBAT);
-                botAI->ChangeStrategy("+chat", BOT_STATE_COMBAT);
-                botAI->ChangeStrategy(value, BOT_STATE_COMBAT);
+                records = std::move(itr->second.records);
+                found = true;
             }
-            else if (key == "nc")
+
+            prefetched.erase(itr);
+        }
+    }
+
+    if (!found)
+    {
+        PlayerbotsDatabasePreparedStatement* stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_SEL_DB_STORE);
+        stmt->SetData(0, guid);
+        if (PreparedQueryResult result = PlayerbotsDatabase.Query(stmt))
+        {
+            do
             {
-                botAI->ClearStrategies(BOT_STATE_NON_COMBAT);
-                botAI->ChangeStrategy("+chat", BOT_STATE_NON_COMBAT);
-                botAI->ChangeStrategy(value, BOT_STATE_NON_COMBAT);
-            }
-            else if (key == "dead")
-                botAI->ChangeStrategy(value, BOT_STATE_DEAD);
-        } while (result->NextRow());
+                Field* fields = result->Fetch();
+                records.emplace_back(fields[0].Get<std::string>(), fields[1].Get<std::string>());
+            } while (result->NextRow());
+        }
+    }
+
+    Apply(botAI, records);
+}
+
+void PlayerbotDbStore::Apply(PlayerbotAI* botAI, PlayerbotDbStoreRecords const& records)
+{
+    if (records.empty())
+        return;
 
-        botAI->GetAiObjectContext()->Load(values);
+    std::vector<std::string> values;
+    for (auto const& [key, value] : records)
+    {
+        if (key == "value")
+            values.push_back(value);
+        else if (key == "co")
+        {
+            botAI->ClearStrategies(BOT_STATE_COMBAT);
+            botAI->ChangeStrategy("+chat", BOT_STATE_COMBAT);
+            botAI->ChangeStrategy(value, BOT_STATE_COMBAT);
+        }
+        else if (key == "nc")
+        {
+            botAI->ClearStrategies(BOT_STATE_NON_COMBAT);
+            botAI->ChangeStrategy("+chat", BOT_STATE_NON_COMBAT);
+            botAI->ChangeStrategy(value, BOT_STATE_NON_COMBAT);
+        }
+        else if (key == "dead")
+            botAI->ChangeStrategy(value, BOT_STATE_DEAD);
     }
+
+    botAI->GetAiObjectContext()->Load(values);
 }
 
 void PlayerbotDbStore::Save(PlayerbotAI* botAI)
 {
     ObjectGuid::LowType guid = botAI->GetBot()->GetGUID().GetCounter();
 
-    Reset(botAI);
-
-    PlayerbotsDatabasePreparedStatement* deleteStatement =
-        PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_DEL_DB_STORE);
-    deleteStatement->SetData(0, guid);
-    PlayerbotsDatabase.Execute(deleteStatement);
-
+    PlayerbotDbStoreRecords records;
     std::vector<std::string> data = botAI->GetAiObjectContext()->Save();
     for (std::vector<std::string>::iterator i = data.begin(); i != data.end(); ++i)
     {
-        SaveValue(guid, "value", *i);
+        records.emplace_back("value", *i);
     }
 
-    SaveValue(guid, "co", FormatStrategies("co", botAI->GetStrategies(BOT_STATE_COMBAT)));
-    SaveValue(guid, "nc", FormatStrategies("nc", botAI->GetStrategies(BOT_STATE_NON_COMBAT)));
-    SaveValue(guid, "dead", FormatStrategies("dead", botAI->GetStrategies(BOT_STATE_DEAD)));
+    records.emplace_back("co", FormatStrategies("co", botAI->GetStrategies(BOT_STATE_COMBAT)));
+    records.emplace_back("nc", FormatStrategies("nc", botAI->GetStrategies(BOT_STATE_NON_COMBAT)));
+    records.emplace_back("dead", FormatStrategies("dead", botAI->GetStrategies(BOT_STATE_DEAD)));
+
+    // written in bulk by the next Update or Flush
+    std::lock_guard<std::mutex> guard(lock);
+    dirty[guid] = std::move(records);
 }
 
 std::string const PlayerbotDbStore::FormatStrategies(std::string const type, std::vector<std::string> strategies)
@@ -85,13 +136,189 @@ void PlayerbotDbStore::Reset(PlayerbotAI* botAI)
     PlayerbotsDatabasePreparedStatement* stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_DEL_CUSTOM_STRATEGY);
     stmt->SetData(0, guid);
     PlayerbotsDatabase.Execute(stmt);
+
+    // a pending or in flight store or prefetched rows would bring the reset strategies back
+    std::lock_guard<std::mutex> guard(lock);
+    dirty.erase(guid);
+    saving.erase(guid);
+    prefetched.erase(guid);
 }
 
-void PlayerbotDbStore::SaveValue(uint32 guid, std::string const key, std::string const value)
+void PlayerbotDbStore::Prefetch(uint32 guid)
 {
-    PlayerbotsDatabasePreparedStatement* stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_INS_DB_STORE);
-    stmt->SetData(0, guid);
-    stmt->SetData(1, key);
-    stmt->SetData(2, value);
-    PlayerbotsDatabase.Execute(stmt);
+    std::lock_guard<std::mutex> guard(lock);
+    PlayerbotDbStorePrefetch& prefetch = prefetched[guid];
+    prefetch = PlayerbotDbStorePrefetch();
+    prefetch.requestId = ++prefetchId;
+    prefetch.time = getMSTime();
+    prefetchQueue.push_back(guid);
+}
+
+void PlayerbotDbStore::CancelPrefetch(uint32 guid)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    prefetched.erase(guid);
+}
+
+void PlayerbotDbStore::Update()
+{
+    queryProcessor.ProcessReadyCallbacks();
+    {
+        std::lock_guard<std::mutex> guard(transactionLock);
+        transactionProcessor.ProcessReadyCallbacks();
+    }
+
+    Flush();
+    IssuePrefetch();
+
+    std::lock_guard<std::mutex> guard(lock);
+    uint32 now = getMSTime();
+    for (auto itr = prefetched.begin(); itr != prefetched.end();)
+    {
+        if (getMSTimeDiff(itr->second.time, now) >= DB_STORE_PREFETCH_TIMEOUT)
+            itr = prefetched.erase(itr);
+        else
+            ++itr;
+    }
+}
+
+void PlayerbotDbStore::IssuePrefetch()
+{
+    // guid -> id of the request this query answers
+    std::map<uint32, uint32> requests;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        for (uint32 guid : prefetchQueue)
+        {
+            // loaded, reset or cancelled before the query went out
+            auto itr = prefetched.find(guid);
+            if (itr == prefetched.end() || itr->second.ready)
+                continue;
+
+            // Load takes unsaved stores from memory, their rows could be read before the commit
+            if (dirty.find(guid) == dirty.end() && saving.find(guid) == saving.end())
+                requests[guid] = itr->second.requestId;
+        }
+
+        prefetchQueue.clear();
+    }
+
+    if (requests.empty())
+        return;
+
+    std::ostringstream in;
+    for (auto i = requests.begin(); i != requests.end(); ++i)
+        in << (i == requests.begin() ? "" : ",") << i->first;
+
+    std::string const query = Acore::StringFormat(
+        "SELECT guid, `key`, `value` FROM playerbots_db_store WHERE guid IN ({}) ORDER BY id", in.str());
+
+    queryProcessor.AddCallback(PlayerbotsDatabase.AsyncQuery(query).WithCallback(
+        [this, requests = std::move(requests)](QueryResult result)
+        {
+            std::lock_guard<std::mutex> guard(lock);
+
+            // entries the bot already loaded without, or that belong to a newer login, are left alone
+            auto current = [this, &requests](uint32 guid) -> PlayerbotDbStorePrefetch*
+            {
+                auto request = requests.find(guid);
+                auto itr = prefetched.find(guid);
+                if (request == requests.end() || itr == prefetched.end() || itr->second.ready ||
+                    itr->second.requestId != request->second)
+                    return nullptr;
+
+                return &itr->second;
+            };
+
+            if (result)
+            {
+                do
+                {
+                    Field* fields = result->Fetch();
+                    if (PlayerbotDbStorePrefetch* prefetch = current(fields[0].Get<uint32>()))
+                        prefetch->records.emplace_back(fields[1].Get<std::string>(), fields[2].Get<std::string>());
+                } while (result->NextRow());
+            }
+
+            for (auto const& request : requests)
+            {
+                if (PlayerbotDbStorePrefetch* prefetch = current(request.first))
+                    prefetch->ready = true;
+            }
+        }));
+}
+
+void PlayerbotDbStore::Flush()
+{
+    std::map<uint32, PlayerbotDbStoreRecords> stores;
+    uint32 id;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        if (dirty.empty())
+            return;
+
+        // stay visible to Load until the transaction is committed
+        id = ++flushId;
+        for (auto const& [guid, records] : dirty)
+            saving[guid] = std::make_pair(id, records);
+
+        stores.swap(dirty);
+    }
+
+    PlayerbotsDatabaseTransaction trans = PlayerbotsDatabase.BeginTransaction();
+
+    std::ostringstream guids;
+    for (std::map<uint32, PlayerbotDbStoreRecords>::iterator i = stores.begin(); i != stores.end(); ++i)
+        guids << (i == stores.begin() ? "" : ",") << i->first;
+
+    // what Reset does for a single bot
+    trans->Append(
+        Acore::StringFormat("DELETE FROM playerbots_custom_strategy WHERE owner IN ({})", guids.str()).c_str());
+    trans->Append(Acore::StringFormat("DELETE FROM playerbots_db_store WHERE guid IN ({})", guids.str()).c_str());
+
+    std::ostringstream insert;
+    uint32 rows = 0;
+    for (auto const& [guid, records] : stores)
+    {
+        for (auto const& [key, value] : records)
+        {
+            std::string escaped = value;
+            PlayerbotsDatabase.EscapeString(escaped);
+
+            insert << (rows ? "," : "INSERT INTO playerbots_db_store (guid, `key`, `value`) VALUES ");
+            insert << "(" << guid << ",'" << key << "','" << escaped << "')";
+
+            if (++rows >= MAX_DB_STORE_ROWS_PER_INSERT)
+            {
+                trans->Append(insert.str().c_str());
+                insert.str("");
+                rows = 0;
+            }
+        }
+    }
+
+    if (rows)
+        trans->Append(insert.str().c_str());
+
+    std::vector<uint32> saved;
+    saved.reserve(stores.size());
+    for (auto const& store : stores)
+        saved.push_back(store.first);
+
+    std::lock_guard<std::mutex> guard(transactionLock);
+    transactionProcessor.AddCallback(PlayerbotsDatabase.AsyncCommitTransaction(trans))
+        .AfterComplete(
+            [this, id, saved = std::move(saved)](bool /*success*/)
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                for (uint32 guid : saved)
+                {
+                    // a later flush of the same bot is still in flight
+                    auto itr = saving.find(guid);
+                    if (itr != saving.end() && itr->second.first == id)
+                        saving.erase(itr);
+                }
+            });
+
+    LOG_DEBUG("playerbots", "Saved {} bot stores in one transaction", stores.size());
 }
@@ -6,12 +6,28 @@
 #ifndef _PLAYERBOT_PLAYERBOTDBSTORE_H
 #define _PLAYERBOT_PLAYERBOTDBSTORE_H
 
+#include <map>
+#include <mutex>
 #include <vector>
 
+#include "AsyncCallbackProcessor.h"
 #include "Common.h"
+#include "QueryCallbackProcessor.h"
+#include "Transaction.h"
 
 class PlayerbotAI;
 
+typedef std::vector<std::pair<std::string, std::string>> PlayerbotDbStoreRecords;
+
+struct PlayerbotDbStorePrefetch
+{
+    // results of older requests for the same bot are ignored
+    uint32 requestId = 0;
+    uint32 time = 0;
+    bool ready = false;
+    PlayerbotDbStoreRecords records;
+};
+
 class PlayerbotDbStore
 {
 public:
@@ -27,9 +43,31 @@ public:
     void Load(PlayerbotAI* botAI);
     void Reset(PlayerbotAI* botAI);
 
+    // Queue a bot for the next bulk prefetch, Load picks the rows up if they arrived in time.
+    void Prefetch(uint32 guid);
+    // Drops the prefetch of a login that failed and will never Load
+    void CancelPrefetch(uint32 guid);
+    // Writes all dirty stores in one transaction, then issues pending prefetches, called from the world update.
+    void Update();
+    void Flush();
+
 private:
-    void SaveValue(uint32 guid, std::string const key, std::string const value);
+    void Apply(PlayerbotAI* botAI, PlayerbotDbStoreRecords const& records);
+    void IssuePrefetch();
     std::string const FormatStrategies(std::string const type, std::vector<std::string> strategies);
+
+    std::map<uint32, PlayerbotDbStoreRecords> dirty;
+    // stores of flushes whose transaction has not committed yet, with the id of the flush that wrote them last
+    std::map<uint32, std::pair<uint32, PlayerbotDbStoreRecords>> saving;
+    uint32 flushId = 0;
+    std::map<uint32, PlayerbotDbStorePrefetch> prefetched;
+    std::vector<uint32> prefetchQueue;
+    uint32 prefetchId = 0;
+    QueryCallbackProcessor queryProcessor;
+    // Flush also runs on logout outside the world update, callbacks take lock so this one is separate
+    AsyncCallbackProcessor<TransactionCallback> transactionProcessor;
+    std::mutex transactionLock;
+    std::mutex lock;
 };
 
 #define sPlayerbotDbStore PlayerbotDbStore::instance()
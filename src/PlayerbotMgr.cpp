@@ -5,6 +5,7 @@
 
 #include "PlayerbotMgr.h"
 
+#include <chrono>
 #include <cstdio>
 #include <cstring>
 #include <istream>
@@ -114,21 +115,61 @@ void PlayerbotHolder::AddPlayerBot(ObjectGuid playerGuid, uint32 masterAccountId
     }
 
     botLoading.insert(playerGuid);
-    
+    sPlayerbotDbStore->Prefetch(playerGuid.GetCounter());
+
+    // world insertion is paced by ProcessBotLogins
     if (WorldSession* masterSession = sWorld->FindSession(masterAccountId))
     {
         masterSession->AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(holder))
-            .AfterComplete([this](SQLQueryHolderBase const& holder)
-                           { HandlePlayerBotLoginCallback(static_cast<PlayerbotLoginQueryHolder const&>(holder)); });
+            .AfterComplete([this, holder](SQLQueryHolderBase const& /*result*/) { botLoginQueue.push_back(holder); });
     }
     else
     {
         sWorld->AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(holder))
-            .AfterComplete([this](SQLQueryHolderBase const& holder)
-                           { HandlePlayerBotLoginCallback(static_cast<PlayerbotLoginQueryHolder const&>(holder)); });
+            .AfterComplete([this, holder](SQLQueryHolderBase const& /*result*/) { botLoginQueue.push_back(holder); });
     }
 }
 
+void PlayerbotHolder::ProcessBotLogins()
+{
+    uint32 const maxLogins = sPlayerbotAIConfig->botLoginsPerUpdate;
+    uint32 processed = 0;
+    while (!botLoginQueue.empty() && (!maxLogins || processed < maxLogins))
+    {
+        std::shared_ptr<PlayerbotLoginQueryHolder> holder = botLoginQueue.front();
+        botLoginQueue.pop_front();
+
+        std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+        HandlePlayerBotLoginCallback(*holder);
+        botLoginWorldTime += std::chrono::duration_cast<std::chrono::microseconds>(
+                                 std::chrono::steady_clock::now() - started).count();
+        ++botLoginCount;
+        ++processed;
+    }
+
+    if (!botLoginStatsTime)
+    {
+        botLoginStatsTime = getMSTime();
+        return;
+    }
+
+    uint32 elapsed = GetMSTimeDiffToNow(botLoginStatsTime);
+    if (elapsed < 60 * IN_MILLISECONDS)
+        return;
+
+    if (botLoginCount)
+    {
+        LOG_INFO("playerbots",
+                 "Bot logins: {} in {}s ({:.1f} bots/sec), {:.2f} ms world thread per login, {} loading, {} waiting",
+                 botLoginCount, elapsed / IN_MILLISECONDS, botLoginCount * 1000.0f / elapsed,
+                 botLoginWorldTime / 1000.0f / botLoginCount, botLoading.size(), botLoginQueue.size());
+    }
+
+    botLoginCount = 0;
+    botLoginWorldTime = 0;
+    botLoginStatsTime = getMSTime();
+}
+
 void PlayerbotHolder::HandlePlayerBotLoginCallback(PlayerbotLoginQueryHolder const& holder)
 {
     uint32 botAccountId = holder.GetAccountId();
@@ -147,6 +188,7 @@ void PlayerbotHolder::HandlePlayerBotLoginCallback(PlayerbotLoginQueryHolder con
         botSession->LogoutPlayer(true);
         delete botSession;
         botLoading.erase(holder.GetGuid());
+        sPlayerbotDbStore->CancelPrefetch(holder.GetGuid().GetCounter());
         return;
     }
 
@@ -168,6 +210,8 @@ void PlayerbotHolder::HandlePlayerBotLoginCallback(PlayerbotLoginQueryHolder con
 
 void PlayerbotHolder::UpdateSessions()
 {
+    ProcessBotLogins();
+
     for (PlayerBotMap::const_iterator itr = GetPlayerBotsBegin(); itr != GetPlayerBotsEnd(); ++itr)
     {
         Player* const bot = itr->second;
@@ -213,6 +257,9 @@ void PlayerbotHolder::LogoutAllBots()
     }
     */
 
+    uint32 oldMSTime = getMSTime();
+    uint32 count = 0;
+
     PlayerBotMap bots = playerBots;
     for (auto& itr : bots)
     {
@@ -225,7 +272,14 @@ void PlayerbotHolder::LogoutAllBots()
             continue;
 
         LogoutPlayerBot(bot->GetGUID());
+        ++count;
     }
+
+    // write the stores of all logged out bots in one transaction
+    sPlayerbotDbStore->Flush();
+
+    if (count)
+        LOG_INFO("playerbots", "Logged out {} bots in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
 }
 
 void PlayerbotMgr::CancelLogout()
@@ -1377,6 +1431,8 @@ void PlayerbotMgr::HandleCommand(uint32 type, std::string const text)
 
 void PlayerbotMgr::HandleMasterIncomingPacket(WorldPacket const& packet)
 {
+    // one copy shared by every bot queueing the packet
+    std::shared_ptr<WorldPacket const> shared;
     for (PlayerBotMap::const_iterator it = GetPlayerBotsBegin(); it != GetPlayerBotsEnd(); ++it)
     {
         Player* const bot = it->second;
@@ -1384,7 +1440,7 @@ void PlayerbotMgr::HandleMasterIncomingPacket(WorldPacket const& packet)
             continue;
         PlayerbotAI* botAI = GET_PLAYERBOT_AI(bot);
         if (botAI)
-            botAI->HandleMasterIncomingPacket(packet);
+            botAI->HandleMasterIncomingPacket(packet, shared);
     }
 
     for (PlayerBotMap::const_iterator it = sRandomPlayerbotMgr->GetPlayerBotsBegin();
@@ -1393,7 +1449,7 @@ void PlayerbotMgr::HandleMasterIncomingPacket(WorldPacket const& packet)
         Player* const bot = it->second;
         PlayerbotAI* botAI = GET_PLAYERBOT_AI(bot);
         if (botAI && botAI->GetMaster() == GetMaster())
-            botAI->HandleMasterIncomingPacket(packet);
+            botAI->HandleMasterIncomingPacket(packet, shared);
     }
 
     switch (packet.GetOpcode())
@@ -1415,12 +1471,14 @@ void PlayerbotMgr::HandleMasterIncomingPacket(WorldPacket const& packet)
 
 void PlayerbotMgr::HandleMasterOutgoingPacket(WorldPacket const& packet)
 {
+    // one copy shared by every bot queueing the packet
+    std::shared_ptr<WorldPacket const> shared;
     for (PlayerBotMap::const_iterator it = GetPlayerBotsBegin(); it != GetPlayerBotsEnd(); ++it)
     {
         Player* const bot = it->second;
         PlayerbotAI* botAI = GET_PLAYERBOT_AI(bot);
         if (botAI)
-            botAI->HandleMasterOutgoingPacket(packet);
+            botAI->HandleMasterOutgoingPacket(packet, shared);
     }
 
     for (PlayerBotMap::const_iterator it = sRandomPlayerbotMgr->GetPlayerBotsBegin();
@@ -1429,7 +1487,7 @@ void PlayerbotMgr::HandleMasterOutgoingPacket(WorldPacket const& packet)
         Player* const bot = it->second;
         PlayerbotAI* botAI = GET_PLAYERBOT_AI(bot);
         if (botAI && botAI->GetMaster() == GetMaster())
-            botAI->HandleMasterOutgoingPacket(packet);
+            botAI->HandleMasterOutgoingPacket(packet, shared);
     }
 }
 
@@ -6,6 +6,9 @@
 #ifndef _PLAYERBOT_PLAYERBOTMGR_H
 #define _PLAYERBOT_PLAYERBOTMGR_H
 
+#include <deque>
+#include <memory>
+
 #include "Common.h"
 #include "ObjectGuid.h"
 #include "Player.h"
@@ -29,6 +32,7 @@ public:
 
     void AddPlayerBot(ObjectGuid guid, uint32 masterAccountId);
     void HandlePlayerBotLoginCallback(PlayerbotLoginQueryHolder const& holder);
+    void ProcessBotLogins();
 
     void LogoutPlayerBot(ObjectGuid guid);
     void DisablePlayerBot(ObjectGuid guid);
@@ -60,6 +64,11 @@ protected:
 
     PlayerBotMap playerBots;
     std::unordered_set<ObjectGuid> botLoading;
+    // bots whose login queries completed and wait for world insertion
+    std::deque<std::shared_ptr<PlayerbotLoginQueryHolder>> botLoginQueue;
+    uint32 botLoginCount = 0;
+    uint64 botLoginWorldTime = 0;
+    uint32 botLoginStatsTime = 0;
 };
 
 class PlayerbotMgr : public PlayerbotHolder
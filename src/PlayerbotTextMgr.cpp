@@ -5,6 +5,8 @@
 
 #include "PlayerbotTextMgr.h"
 
+#include <cctype>
+
 #include "Playerbots.h"
 
 void PlayerbotTextMgr::replaceAll(std::string& str, const std::string& from, const std::string& to)
@@ -19,6 +21,101 @@ void PlayerbotTextMgr::replaceAll(std::string& str, const std::string& from, con
     }
 }
 
+static bool IsPlaceholderChar(char c) { return isalnum(static_cast<unsigned char>(c)) || c == '_'; }
+
+void BotTextTemplate::Compile(std::string const& text)
+{
+    segments.clear();
+    literalSize = 0;
+
+    size_t literalStart = 0;
+    size_t pos = 0;
+    while (pos < text.size())
+    {
+        char c = text[pos];
+        size_t end = pos + 1;
+        if (c == '%' || c == '<')
+        {
+            while (end < text.size() && IsPlaceholderChar(text[end]))
+                ++end;
+
+            if (c == '<')
+                end = (end < text.size() && text[end] == '>' && end > pos + 1) ? end + 1 : pos + 1;
+        }
+
+        if (end <= pos + 1)
+        {
+            ++pos;
+            continue;
+        }
+
+        if (pos > literalStart)
+        {
+            segments.push_back({text.substr(literalStart, pos - literalStart), false});
+            literalSize += pos - literalStart;
+        }
+
+        segments.push_back({text.substr(pos, end - pos), true});
+        pos = literalStart = end;
+    }
+
+    if (literalStart < text.size())
+    {
+        segments.push_back({text.substr(literalStart), false});
+        literalSize += text.size() - literalStart;
+    }
+}
+
+// exact slot name first, then the longest placeholder the slot starts with ("%s" in "%ss")
+static std::string const* FindPlaceholder(std::map<std::string, std::string> const& placeholders,
+                                          std::string const& slot, size_t& matched)
+{
+    if (placeholders.empty())
+        return nullptr;
+
+    for (matched = slot.size(); matched > 1; --matched)
+    {
+        auto i = placeholders.find(matched == slot.size() ? slot : slot.substr(0, matched));
+        if (i != placeholders.end())
+            return &i->second;
+    }
+
+    return nullptr;
+}
+
+std::string BotTextTemplate::Render(std::map<std::string, std::string> const& placeholders) const
+{
+    size_t size = literalSize;
+    for (Segment const& segment : segments)
+    {
+        if (!segment.placeholder)
+            continue;
+
+        size_t matched = 0;
+        std::string const* value = FindPlaceholder(placeholders, segment.text, matched);
+        size += value ? value->size() + segment.text.size() - matched : segment.text.size();
+    }
+
+    std::string text;
+    text.reserve(size);
+    for (Segment const& segment : segments)
+    {
+        size_t matched = 0;
+        std::string const* value =
+            segment.placeholder ? FindPlaceholder(placeholders, segment.text, matched) : nullptr;
+        if (!value)
+        {
+            text.append(segment.text);
+            continue;
+        }
+
+        text.append(*value);
+        text.append(segment.text, matched, std::string::npos);
+    }
+
+    return text;
+}
+
 void PlayerbotTextMgr::LoadBotTexts()
 {
     LOG_INFO("playerbots", "Loading playerbots texts...");
@@ -69,73 +166,85 @@ void PlayerbotTextMgr::LoadBotTextChance()
 
 // general texts
 
-std::string PlayerbotTextMgr::GetBotText(std::string name)
+BotTextTemplate const& PlayerbotTextMgr::GetLocaleTemplate(BotTextEntry const& entry)
+{
+    auto i = entry.m_templates.find(GetLocalePriority());
+    if (i != entry.m_templates.end() && !i->second.segments.empty())
+        return i->second;
+
+    static BotTextTemplate const emptyTemplate;
+    i = entry.m_templates.find(0);
+    return i != entry.m_templates.end() ? i->second : emptyTemplate;
+}
+
+BotTextTemplate const* PlayerbotTextMgr::SelectBotText(std::string const& name)
 {
     if (botTexts.empty())
     {
         LOG_ERROR("playerbots", "Can't get bot text {}! No bots texts loaded!", name);
-        return "";
+        return nullptr;
     }
 
-    if (botTexts[name].empty())
+    auto i = botTexts.find(name);
+    if (i == botTexts.end() || i->second.empty())
     {
         LOG_ERROR("playerbots", "Can't get bot text {}! No bots texts for this name!", name);
-        return "";
+        return nullptr;
     }
 
-    std::vector<BotTextEntry>& list = botTexts[name];
-    BotTextEntry textEntry = list[urand(0, list.size() - 1)];
-    return !textEntry.m_text[GetLocalePriority()].empty() ? textEntry.m_text[GetLocalePriority()] : textEntry.m_text[0];
+    std::vector<BotTextEntry> const& list = i->second;
+    return &GetLocaleTemplate(list[urand(0, list.size() - 1)]);
 }
 
-std::string PlayerbotTextMgr::GetBotText(std::string name, std::map<std::string, std::string> placeholders)
+std::string PlayerbotTextMgr::GetBotText(std::string const& name)
 {
-    std::string botText = GetBotText(name);
-    if (botText.empty())
-        return "";
+    static std::map<std::string, std::string> const noPlaceholders;
+    return GetBotText(name, noPlaceholders);
+}
 
-    for (std::map<std::string, std::string>::iterator i = placeholders.begin(); i != placeholders.end(); ++i)
-        replaceAll(botText, i->first, i->second);
+std::string PlayerbotTextMgr::GetBotText(std::string const& name,
+                                         std::map<std::string, std::string> const& placeholders)
+{
+    BotTextTemplate const* botText = SelectBotText(name);
+    if (!botText)
+        return "";
 
-    return botText;
+    return botText->Render(placeholders);
 }
 
 // chat replies
 
-std::string PlayerbotTextMgr::GetBotText(ChatReplyType replyType, std::map<std::string, std::string> placeholders)
+std::string PlayerbotTextMgr::GetBotText(ChatReplyType replyType,
+                                         std::map<std::string, std::string> const& placeholders)
 {
     if (botTexts.empty())
     {
         LOG_ERROR("playerbots", "Can't get bot text reply {}! No bots texts loaded!", replyType);
         return "";
     }
-    if (botTexts["reply"].empty())
+
+    auto i = botTexts.find("reply");
+    if (i == botTexts.end() || i->second.empty())
     {
         LOG_ERROR("playerbots", "Can't get bot text reply {}! No bots texts replies!", replyType);
         return "";
     }
 
-    std::vector<BotTextEntry>& list = botTexts["reply"];
-    std::vector<BotTextEntry> proper_list;
-    for (auto text : list)
+    std::vector<BotTextEntry const*> proper_list;
+    for (BotTextEntry const& text : i->second)
     {
         if (text.m_replyType == replyType)
-            proper_list.push_back(text);
+            proper_list.push_back(&text);
     }
 
     if (proper_list.empty())
         return "";
 
-    BotTextEntry textEntry = proper_list[urand(0, proper_list.size() - 1)];
-    std::string botText =
-        !textEntry.m_text[GetLocalePriority()].empty() ? textEntry.m_text[GetLocalePriority()] : textEntry.m_text[0];
-    for (auto& placeholder : placeholders)
-        replaceAll(botText, placeholder.first, placeholder.second);
-
-    return botText;
+    BotTextEntry const* textEntry = proper_list[urand(0, proper_list.size() - 1)];
+    return GetLocaleTemplate(*textEntry).Render(placeholders);
 }
 
-std::string PlayerbotTextMgr::GetBotText(ChatReplyType replyType, std::string name)
+std::string PlayerbotTextMgr::GetBotText(ChatReplyType replyType, std::string const& name)
 {
     std::map<std::string, std::string> placeholders;
     placeholders["%s"] = name;
@@ -145,15 +254,16 @@ std::string PlayerbotTextMgr::GetBotText(ChatReplyType replyType, std::string na
 
 // probabilities
 
-bool PlayerbotTextMgr::rollTextChance(std::string name)
+bool PlayerbotTextMgr::rollTextChance(std::string const& name)
 {
-    if (!botTextChance[name])
+    auto i = botTextChance.find(name);
+    if (i == botTextChance.end() || !i->second)
         return true;
 
-    return urand(0, 100) < botTextChance[name];
+    return urand(0, 100) < i->second;
 }
 
-bool PlayerbotTextMgr::GetBotText(std::string name, std::string& text)
+bool PlayerbotTextMgr::GetBotText(std::string const& name, std::string& text)
 {
     if (!rollTextChance(name))
         return false;
@@ -162,7 +272,8 @@ bool PlayerbotTextMgr::GetBotText(std::string name, std::string& text)
     return !text.empty();
 }
 
-bool PlayerbotTextMgr::GetBotText(std::string name, std::string& text, std::map<std::string, std::string> placeholders)
+bool PlayerbotTextMgr::GetBotText(std::string const& name, std::string& text,
+                                  std::map<std::string, std::string> const& placeholders)
 {
     if (!rollTextChance(name))
         return false;
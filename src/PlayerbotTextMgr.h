@@ -9,19 +9,39 @@
 #include <map>
 #include <vector>
 
+#include "ChatDispatcher.h"
 #include "Common.h"
 
 #define BOT_TEXT1(name) sPlayerbotTextMgr->GetBotText(name)
 #define BOT_TEXT2(name, replace) sPlayerbotTextMgr->GetBotText(name, replace)
 
+// Bot text split at load time into literal runs and %name / <name> placeholder slots
+struct BotTextTemplate
+{
+    struct Segment
+    {
+        std::string text;
+        bool placeholder = false;
+    };
+
+    std::vector<Segment> segments;
+    size_t literalSize = 0;
+
+    void Compile(std::string const& text);
+    std::string Render(std::map<std::string, std::string> const& placeholders) const;
+};
+
 struct BotTextEntry
 {
     BotTextEntry(std::string name, std::map<uint32, std::string> text, uint32 say_type, uint32 reply_type)
         : m_name(name), m_text(text), m_sayType(say_type), m_replyType(reply_type)
     {
+        for (auto const& locale : m_text)
+            m_templates[locale.first].Compile(locale.second);
     }
     std::string m_name;
     std::map<uint32, std::string> m_text;
+    std::map<uint32, BotTextTemplate> m_templates;
     uint32 m_sayType;
     uint32 m_replyType;
 };
@@ -35,17 +55,8 @@ struct ChatReplyData
 
 struct ChatQueuedReply
 {
-    ChatQueuedReply(uint32 type, uint32 guid1, uint32 guid2, std::string msg, std::string chanName, std::string name,
-                    time_t time)
-        : m_type(type), m_guid1(guid1), m_guid2(guid2), m_msg(msg), m_chanName(chanName), m_name(name), m_time(time)
-    {
-    }
-    uint32 m_type;
-    uint32 m_guid1;
-    uint32 m_guid2;
-    std::string m_msg;
-    std::string m_chanName;
-    std::string m_name;
+    ChatQueuedReply(ParsedChatMessagePtr message, time_t time) : m_message(std::move(message)), m_time(time) {}
+    ParsedChatMessagePtr m_message;
     time_t m_time;
 };
 
@@ -77,22 +88,26 @@ public:
         return &instance;
     }
 
-    std::string GetBotText(std::string name, std::map<std::string, std::string> placeholders);
-    std::string GetBotText(std::string name);
-    std::string GetBotText(ChatReplyType replyType, std::map<std::string, std::string> placeholders);
-    std::string GetBotText(ChatReplyType replyType, std::string name);
-    bool GetBotText(std::string name, std::string& text);
-    bool GetBotText(std::string name, std::string& text, std::map<std::string, std::string> placeholders);
+    std::string GetBotText(std::string const& name, std::map<std::string, std::string> const& placeholders);
+    std::string GetBotText(std::string const& name);
+    std::string GetBotText(ChatReplyType replyType, std::map<std::string, std::string> const& placeholders);
+    std::string GetBotText(ChatReplyType replyType, std::string const& name);
+    bool GetBotText(std::string const& name, std::string& text);
+    bool GetBotText(std::string const& name, std::string& text,
+                    std::map<std::string, std::string> const& placeholders);
     void LoadBotTexts();
     void LoadBotTextChance();
     static void replaceAll(std::string& str, const std::string& from, const std::string& to);
-    bool rollTextChance(std::string text);
+    bool rollTextChance(std::string const& text);
 
     uint32 GetLocalePriority();
     void AddLocalePriority(uint32 locale);
     void ResetLocalePriority();
 
 private:
+    BotTextTemplate const* SelectBotText(std::string const& name);
+    BotTextTemplate const& GetLocaleTemplate(BotTextEntry const& entry);
+
     std::map<std::string, std::vector<BotTextEntry>> botTexts;
     std::map<std::string, uint32> botTextChance;
     uint32 botTextLocalePriority[MAX_LOCALES];
@@ -17,12 +17,18 @@
 
 #include "Playerbots.h"
 
+#include "AiFactory.h"
 #include "Channel.h"
 #include "Config.h"
 #include "DatabaseEnv.h"
 #include "DatabaseLoader.h"
+#include "FormationSolver.h"
 #include "GuildTaskMgr.h"
 #include "Metric.h"
+#include "PathCache.h"
+#include "PerformanceMonitor.h"
+#include "PlayerbotCommandServer.h"
+#include "PlayerbotDbStore.h"
 #include "RandomPlayerbotMgr.h"
 #include "ScriptMgr.h"
 #include "cs_playerbots.h"
@@ -122,6 +128,15 @@ public:
         }
     }
 
+    void OnLearnTalents(Player* player, uint32 /*talentId*/, uint32 /*talentRank*/, uint32 /*spellid*/) override
+    {
+        AiFactory::ResetPlayerSpecTab(player);
+    }
+
+    void OnTalentsReset(Player* player, bool /*noCost*/) override { AiFactory::ResetPlayerSpecTab(player); }
+
+    void OnAfterSpecSlotChanged(Player* player, uint8 /*newSlot*/) override { AiFactory::ResetPlayerSpecTab(player); }
+
     void OnAfterUpdate(Player* player, uint32 diff) override
     {
         if (PlayerbotAI* botAI = GET_PLAYERBOT_AI(player))
@@ -224,6 +239,8 @@ public:
 
     void OnDestructPlayer(Player* player) override
     {
+        AiFactory::ResetPlayerSpecTab(player);
+
         if (PlayerbotAI* botAI = GET_PLAYERBOT_AI(player))
         {
             delete botAI;
@@ -343,6 +360,11 @@ public:
     {
         sRandomPlayerbotMgr->UpdateAI(diff);
         sRandomPlayerbotMgr->UpdateSessions();
+        sPlayerbotDbStore->Update();
+        sPlayerbotCommandServer->Update();
+        sPathCache->Update();
+        sFormationSolver->Update();
+        sPerformanceMonitor->Update();
     }
 
     void OnPlayerbotUpdateSessions(Player* player) override
@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#include "QuestIndex.h"
+
+#include "Log.h"
+#include "ObjectMgr.h"
+#include "Playerbots.h"
+#include "SharedValueContext.h"
+#include "World.h"
+
+void QuestIndex::Init()
+{
+    // Bots keep references into the tables, the spawn data does not change on config reload
+    if (loaded)
+        return;
+
+    loaded = true;
+
+    LoadEntryRelations();
+
+    for (auto const& itr : sObjectMgr->GetAllCreatureData())
+        AddSpawn(itr.second.id1, GuidPosition(itr.second));
+
+    for (auto const& itr : sObjectMgr->GetAllGOData())
+        AddSpawn(-(int32)itr.second.id, GuidPosition(itr.second));
+
+    // Level views: index 0 holds every giver, the others the quests useful at that level
+    uint32 maxLevel = sWorld->getIntConfig(CONFIG_MAX_PLAYER_LEVEL);
+    giversByLevel.resize(maxLevel + 1);
+
+    for (auto const& giver : givers)
+    {
+        Quest const* quest = sObjectMgr->GetQuestTemplate(giver.first);
+
+        for (uint32 level = 0; level <= maxLevel; ++level)
+        {
+            if (level && quest && (level < quest->GetMinLevel() || (int32)level > quest->GetQuestLevel() + 10))
+                continue;
+
+            giversByLevel[level].push_back(&giver);
+        }
+    }
+
+    LOG_INFO("playerbots", "Indexed {} quests with {} quest givers", questMap.size(), givers.size());
+}
+
+// What kind of a relation does this entry have with this quest.
+void QuestIndex::LoadEntryRelations()
+{
+    for (auto relation : *sObjectMgr->GetCreatureQuestRelationMap())
+        relationMap[relation.first][relation.second] |= (int)QuestRelationFlag::questGiver;
+
+    for (auto relation : *sObjectMgr->GetCreatureQuestInvolvedRelationMap())
+        relationMap[relation.first][relation.second] |= (int)QuestRelationFlag::questTaker;
+
+    for (auto relation : *sObjectMgr->GetGOQuestRelationMap())
+        relationMap[-(int32)relation.first][relation.second] |= (int)QuestRelationFlag::questGiver;
+
+    for (auto relation : *sObjectMgr->GetGOQuestInvolvedRelationMap())
+        relationMap[-(int32)relation.first][relation.second] |= (int)QuestRelationFlag::questGiver;
+
+    // Quest objectives
+    ObjectMgr::QuestMap const& questTemplates = sObjectMgr->GetQuestTemplates();
+
+    for (auto& questItr : questTemplates)
+    {
+        uint32 questId = questItr.first;
+        Quest* quest = questItr.second;
+
+        for (uint32 objective = 0; objective < QUEST_OBJECTIVES_COUNT; objective++)
+        {
+            uint32 relationFlag = 1 << objective;
+
+            // Kill objective
+            if (quest->RequiredNpcOrGo[objective])
+                relationMap[quest->RequiredNpcOrGo[objective]][questId] |= relationFlag;
+
+            // Loot objective
+            if (quest->RequiredItemId[objective])
+            {
+                for (auto& entry : GAI_VALUE2(std::vector<int32>, "item drop list", quest->RequiredItemId[objective]))
+                    relationMap[entry][questId] |= relationFlag;
+            }
+        }
+    }
+}
+
+// Puts a spawn in the proper place for every quest its entry is related to.
+void QuestIndex::AddSpawn(int32 entry, GuidPosition const& guidp)
+{
+    auto relations = relationMap.find(entry);
+    if (relations == relationMap.end())
+        return;
+
+    for (auto const& relation : relations->second)
+    {
+        uint32 questId = relation.first;
+        uint32 flag = relation.second;
+        questMap[questId][flag][entry].push_back(guidp);
+
+        // Only pure givers, as the quest map is keyed by the combined flag
+        if (flag == (uint32)QuestRelationFlag::questGiver)
+            givers[questId].push_back(guidp);
+    }
+}
+
+questGiverList const& QuestIndex::GetQuestGivers(uint32 level) const
+{
+    static questGiverList const empty;
+
+    if (giversByLevel.empty())
+        return empty;
+
+    return giversByLevel[std::min<uint32>(level, giversByLevel.size() - 1)];
+}
+
+questEntryGuidps const* QuestIndex::GetQuestRelations(uint32 questId, QuestRelationFlag flag) const
+{
+    auto q = questMap.find(questId);
+    if (q == questMap.end())
+        return nullptr;
+
+    auto r = q->second.find((uint32)flag);
+    if (r == q->second.end())
+        return nullptr;
+
+    return &r->second;
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#ifndef _PLAYERBOT_QUESTINDEX_H
+#define _PLAYERBOT_QUESTINDEX_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "Common.h"
+#include "TravelMgr.h"
+
+struct CreatureData;
+struct GameObjectData;
+
+enum class QuestRelationFlag : uint32
+{
+    none = 0,
+    objective1 = 1,
+    objective2 = 2,
+    objective3 = 4,
+    objective4 = 8,
+    questGiver = 16,
+    questTaker = 32,
+    maxQuestRelationFlag = 64
+};
+
+//                     questId, QuestRelationFlag
+typedef std::unordered_map<uint32, uint32> questRelationMap;
+//                     entry
+typedef std::unordered_map<int32, questRelationMap> entryQuestRelationMap;
+
+//                      entry
+typedef std::unordered_map<int32, std::vector<GuidPosition>> questEntryGuidps;
+
+//                      QuestRelationFlag
+typedef std::unordered_map<uint32, questEntryGuidps> questRelationGuidps;
+
+//                      questId
+typedef std::unordered_map<uint32, questRelationGuidps> questGuidpMap;
+
+//                      questId
+typedef std::unordered_map<uint32, std::vector<GuidPosition>> questGiverMap;
+
+// Quest givers of a level range, pointing into the full giver map
+typedef std::vector<questGiverMap::value_type const*> questGiverList;
+
+// All creatures and gameobjects that start, take or are needed for a quest. Built once at startup from the spawn
+// data and never changed afterwards, so every bot reads the same tables by reference.
+class QuestIndex
+{
+public:
+    QuestIndex() {}
+    virtual ~QuestIndex() {}
+    static QuestIndex* instance()
+    {
+        static QuestIndex instance;
+        return &instance;
+    }
+
+    void Init();
+
+    entryQuestRelationMap const& GetEntryRelations() const { return relationMap; }
+    questGuidpMap const& GetQuestGuidpMap() const { return questMap; }
+    questGiverMap const& GetQuestGivers() const { return givers; }
+    questGiverList const& GetQuestGivers(uint32 level) const;
+    questEntryGuidps const* GetQuestRelations(uint32 questId, QuestRelationFlag flag) const;
+
+private:
+    void LoadEntryRelations();
+    void AddSpawn(int32 entry, GuidPosition const& guidp);
+
+    bool loaded = false;
+    entryQuestRelationMap relationMap;
+    questGuidpMap questMap;
+    questGiverMap givers;
+    std::vector<questGiverList> giversByLevel;
+};
+
+#define sQuestIndex QuestIndex::instance()
+
+#endif
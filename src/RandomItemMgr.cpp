@@ -6,7 +6,6 @@
 #include "RandomItemMgr.h"
 
 #include "ItemTemplate.h"
-#include "LootValues.h"
 #include "Playerbots.h"
 
 char* strstri(char const* str1, char const* str2);
@@ -153,6 +152,14 @@ RandomItemMgr::RandomItemMgr()
 
 void RandomItemMgr::Init()
 {
+    // Bots read the tables without locking, they are not rebuilt on config reload
+    if (loaded)
+        return;
+
+    loaded = true;
+
+    uint32 timer = getMSTime();
+
     BuildItemInfoCache();
     // BuildEquipCache();
     BuildEquipCacheNew();
@@ -160,10 +167,17 @@ void RandomItemMgr::Init()
     BuildPotionCache();
     BuildFoodCache();
     BuildTradeCache();
+
+    LOG_INFO("server.loading", ">> Random item caches built in {} ms", GetMSTimeDiffToNow(timer));
 }
 
 void RandomItemMgr::InitAfterAhBot()
 {
+    if (randomItemsLoaded)
+        return;
+
+    randomItemsLoaded = true;
+
     BuildRandomItemCache();
     // BuildRarityCache();
 }
@@ -187,14 +201,16 @@ bool RandomItemMgr::HandleConsoleCommand(ChatHandler* handler, char const* args)
     return false;
 }
 
-RandomItemList RandomItemMgr::Query(uint32 level, RandomItemType type, RandomItemPredicate* predicate)
+RandomItemList RandomItemMgr::Query(uint32 level, RandomItemType type, RandomItemPredicate* predicate) const
 {
-    RandomItemList& list = randomItemCache[(level - 1) / 10][type];
-
     RandomItemList result;
-    for (RandomItemList::iterator i = list.begin(); i != list.end(); ++i)
+
+    uint32 index = (level - 1) / 10;
+    if (!level || index >= randomItemCache.size() || type >= MAX_RANDOM_ITEM_TYPE)
+        return result;
+
+    for (uint32 itemId : randomItemCache[index][type])
     {
-        uint32 itemId = *i;
         ItemTemplate const* proto = sObjectMgr->GetItemTemplate(itemId);
         if (!proto)
             continue;
@@ -222,8 +238,13 @@ void RandomItemMgr::BuildRandomItemCache()
             uint32 type = fields[1].Get<uint32>();
             uint32 itemId = fields[2].Get<uint32>();
 
-            RandomItemType rit = (RandomItemType)type;
-            randomItemCache[level][rit].push_back(itemId);
+            if (type >= MAX_RANDOM_ITEM_TYPE)
+                continue;
+
+            if (level >= randomItemCache.size())
+                randomItemCache.resize(level + 1);
+
+            randomItemCache[level][type].push_back(itemId);
             ++count;
 
         } while (result->NextRow());
@@ -261,6 +282,9 @@ void RandomItemMgr::BuildRandomItemCache()
                 if (predicates[rit] && !predicates[rit]->Apply(proto))
                     continue;
 
+                if (level / 10 >= randomItemCache.size())
+                    randomItemCache.resize(level / 10 + 1);
+
                 randomItemCache[level / 10][rit].push_back(itr.first);
 
                 PlayerbotsDatabasePreparedStatement* stmt =
@@ -276,17 +300,16 @@ void RandomItemMgr::BuildRandomItemCache()
         if (maxLevel > sWorld->getIntConfig(CONFIG_MAX_PLAYER_LEVEL))
             maxLevel = sWorld->getIntConfig(CONFIG_MAX_PLAYER_LEVEL);
 
-        for (uint32 level = 0; level < maxLevel / 10; level++)
+        for (uint32 level = 0; level < maxLevel / 10 && level < randomItemCache.size(); level++)
         {
             for (uint32 type = RANDOM_ITEM_GUILD_TASK; type <= RANDOM_ITEM_GUILD_TASK_REWARD_TRADE_RARE; type++)
             {
-                RandomItemList list = randomItemCache[level][(RandomItemType)type];
+                RandomItemList const& list = randomItemCache[level][type];
                 LOG_INFO("playerbots", "    Level {}..{} Type {} - {} random items cached", level * 10, level * 10 + 9,
                          type, list.size());
 
-                for (RandomItemList::iterator i = list.begin(); i != list.end(); ++i)
+                for (uint32 itemId : list)
                 {
-                    uint32 itemId = *i;
                     ItemTemplate const* proto = sObjectMgr->GetItemTemplate(itemId);
                     if (!proto)
                         continue;
@@ -298,7 +321,7 @@ void RandomItemMgr::BuildRandomItemCache()
     }
 }
 
-uint32 RandomItemMgr::GetRandomItem(uint32 level, RandomItemType type, RandomItemPredicate* predicate)
+uint32 RandomItemMgr::GetRandomItem(uint32 level, RandomItemType type, RandomItemPredicate* predicate) const
 {
     RandomItemList const& list = Query(level, type, predicate);
     if (list.empty())
@@ -324,8 +347,8 @@ bool RandomItemMgr::CanEquipItem(BotEquipKey key, ItemTemplate const* proto)
     if (proto->Class == ITEM_CLASS_CONTAINER)
         return true;
 
-    std::set<InventoryType> slots = viableSlots[(EquipmentSlots)key.slot];
-    if (slots.find((InventoryType)proto->InventoryType) == slots.end())
+    auto slots = viableSlots.find((EquipmentSlots)key.slot);
+    if (slots == viableSlots.end() || slots->second.find((InventoryType)proto->InventoryType) == slots->second.end())
         return false;
 
     uint32 requiredLevel = proto->RequiredLevel;
@@ -447,8 +470,13 @@ bool RandomItemMgr::CheckItemStats(uint8 clazz, uint8 sp, uint8 ap, uint8 tank)
     return sp || ap || tank;
 }
 
-std::vector<uint32> RandomItemMgr::GetCachedEquipments(uint32 requiredLevel, uint32 inventoryType)
+std::vector<uint32> const& RandomItemMgr::GetCachedEquipments(uint32 requiredLevel, uint32 inventoryType) const
 {
+    static std::vector<uint32> const empty;
+
+    if (requiredLevel >= equipCacheNew.size() || inventoryType >= MAX_INVTYPE)
+        return empty;
+
     return equipCacheNew[requiredLevel][inventoryType];
 }
 
@@ -906,61 +934,12 @@ void RandomItemMgr::BuildItemInfoCache()
         return;
     }
 
-    // vendor items
-    LOG_INFO("playerbots", "Loading vendor item list...");
-
-    std::set<uint32> vendorItems;
-    vendorItems.clear();
-    if (QueryResult result = WorldDatabase.Query("SELECT item FROM npc_vendor"))
-    {
-        do
-        {
-            Field* fields = result->Fetch();
-            int32 entry = fields[0].Get<int32>();
-            if (entry <= 0)
-                continue;
-
-            vendorItems.insert(entry);
-        } while (result->NextRow());
-    }
-
-    LOG_INFO("playerbots", "Loaded {} vendor items...", vendorItems.size());
-
-    // calculate drop source
-    LOG_INFO("playerbots", "Loading loot templates...");
-    DropMap* dropMap = new DropMap;
-
-    if (CreatureTemplateContainer const* creatures = sObjectMgr->GetCreatureTemplates())
-    {
-        for (CreatureTemplateContainer::const_iterator itr = creatures->begin(); itr != creatures->end(); ++itr)
-        {
-            uint32 sEntry = itr->first;
-            if (LootTemplateAccess const* lTemplateA =
-                    DropMapValue::GetLootTemplate(ObjectGuid::Create<HighGuid::Unit>(sEntry, uint32(1)), LOOT_CORPSE))
-                for (auto const& lItem : lTemplateA->Entries)
-                    dropMap->insert(std::make_pair(lItem->itemid, sEntry));
-        }
-    }
-
-    if (GameObjectTemplateContainer const* gameobjects = sObjectMgr->GetGameObjectTemplates())
-    {
-        for (auto const& itr : *gameobjects)
-        {
-            uint32 sEntry = itr.first;
-            if (LootTemplateAccess const* lTemplateA = DropMapValue::GetLootTemplate(
-                    ObjectGuid::Create<HighGuid::GameObject>(sEntry, uint32(1)), LOOT_CORPSE))
-                for (auto const& lItem : lTemplateA->Entries)
-                    dropMap->insert(std::make_pair(lItem->itemid, sEntry));
-        }
-    }
-
-    LOG_INFO("playerbots", "Loaded {} loot templates...", dropMap->size());
+    // The vendor list and drop map used as item sources are only needed by the disabled stat weight cache below,
+    // they are not loaded while it stays disabled.
 
     ItemTemplateContainer const* itemTemplate = sObjectMgr->GetItemTemplateStore();
     LOG_INFO("playerbots", "Calculating stat weights for {} items...", itemTemplate->size());
 
-    PlayerbotsDatabaseTransaction trans = PlayerbotsDatabase.BeginTransaction();
-
     for (auto const& itr : *itemTemplate)
     {
         ItemTemplate const* proto = &itr.second;
@@ -1263,8 +1242,6 @@ void RandomItemMgr::BuildItemInfoCache()
 
         // itemInfoCache[cacheInfo.itemId] = std::move(cacheInfo);
     }
-
-    PlayerbotsDatabase.CommitTransaction(trans);
 }
 
 uint32 RandomItemMgr::CalculateStatWeight(uint8 playerclass, uint8 spec, ItemTemplate const* proto)
@@ -2225,7 +2202,7 @@ void RandomItemMgr::BuildEquipCacheNew()
                 if (proto->Class != ITEM_CLASS_WEAPON && proto->Class != ITEM_CLASS_ARMOR)
                     continue;
                 int requiredLevel = std::max((int)proto->RequiredLevel, quest->GetQuestLevel());
-                equipCacheNew[requiredLevel][proto->InventoryType].push_back(itemId);
+                AddCachedEquipment(requiredLevel, proto);
                 questItemIds.insert(itemId);
             }
 
@@ -2236,7 +2213,7 @@ void RandomItemMgr::BuildEquipCacheNew()
                 if (proto->Class != ITEM_CLASS_WEAPON && proto->Class != ITEM_CLASS_ARMOR)
                     continue;
                 int requiredLevel = std::max((int)proto->RequiredLevel, quest->GetQuestLevel());
-                equipCacheNew[requiredLevel][proto->InventoryType].push_back(itemId);
+                AddCachedEquipment(requiredLevel, proto);
                 questItemIds.insert(itemId);
             }
     }
@@ -2260,10 +2237,21 @@ void RandomItemMgr::BuildEquipCacheNew()
         {  // Sunwell Orb
             continue;
         }
-        equipCacheNew[proto->RequiredLevel][proto->InventoryType].push_back(itemId);
+        AddCachedEquipment(proto->RequiredLevel, proto);
     }
 }
 
+void RandomItemMgr::AddCachedEquipment(uint32 requiredLevel, ItemTemplate const* proto)
+{
+    if (proto->InventoryType >= MAX_INVTYPE)
+        return;
+
+    if (requiredLevel >= equipCacheNew.size())
+        equipCacheNew.resize(requiredLevel + 1);
+
+    equipCacheNew[requiredLevel][proto->InventoryType].push_back(proto->ItemId);
+}
+
 RandomItemList RandomItemMgr::Query(uint32 level, uint8 clazz, uint8 slot, uint32 quality)
 {
     // return equipCache[key];
@@ -2307,37 +2295,65 @@ void RandomItemMgr::BuildAmmoCache()
 
     LOG_INFO("server.loading", "Building ammo cache for {} levels", maxLevel);
 
+    // Same order the per level item_template query used: most stackable first, then highest required level
+    std::map<uint32, std::vector<ItemTemplate const*>> candidates;
+    for (auto const& itr : *sObjectMgr->GetItemTemplateStore())
+    {
+        ItemTemplate const* proto = &itr.second;
+        if (proto->Class != ITEM_CLASS_PROJECTILE || proto->SubClass < ITEM_SUBCLASS_ARROW ||
+            proto->SubClass > ITEM_SUBCLASS_BULLET)
+            continue;
+
+        if (proto->Duration || (proto->Flags & ITEM_FLAG_DEPRECATED))
+            continue;
+
+        candidates[proto->SubClass].push_back(proto);
+    }
+
+    for (auto& [subClass, protos] : candidates)
+    {
+        std::sort(protos.begin(), protos.end(),
+                  [](ItemTemplate const* a, ItemTemplate const* b)
+                  {
+                      if (a->Stackable != b->Stackable)
+                          return a->Stackable > b->Stackable;
+
+                      if (a->RequiredLevel != b->RequiredLevel)
+                          return a->RequiredLevel > b->RequiredLevel;
+
+                      return a->ItemId < b->ItemId;
+                  });
+    }
+
+    ammoCache.assign(maxLevel + 1, {});
+
     uint32 counter = 0;
     for (uint32 level = 1; level <= maxLevel; level += 1)
     {
         for (uint32 subClass = ITEM_SUBCLASS_ARROW; subClass <= ITEM_SUBCLASS_BULLET; subClass++)
         {
-            QueryResult results = WorldDatabase.Query(
-                "SELECT entry, Flags FROM item_template WHERE class = {} AND subclass = {} AND RequiredLevel <= {} and duration = 0 "
-                "ORDER BY stackable DESC, RequiredLevel DESC",
-                ITEM_CLASS_PROJECTILE, subClass, level);
-            if (!results)
-                continue;
-            do
+            for (ItemTemplate const* proto : candidates[subClass])
             {
-                Field* fields = results->Fetch();
-                uint32 entry = fields[0].Get<uint32>();
-                uint32 flags = fields[1].Get<uint32>();
-                if (flags & ITEM_FLAG_DEPRECATED)
-                {
+                if (proto->RequiredLevel > level)
                     continue;
-                }
-                ammoCache[level][subClass] = entry;
+
+                ammoCache[level][subClass - ITEM_SUBCLASS_ARROW] = proto->ItemId;
                 ++counter;
                 break;
-            } while (results->NextRow());
+            }
         }
     }
 
     LOG_INFO("server.loading", "Cached {} types of ammo", counter);  // TEST
 }
 
-uint32 RandomItemMgr::GetAmmo(uint32 level, uint32 subClass) { return ammoCache[level][subClass]; }
+uint32 RandomItemMgr::GetAmmo(uint32 level, uint32 subClass) const
+{
+    if (level >= ammoCache.size() || subClass < ITEM_SUBCLASS_ARROW || subClass > ITEM_SUBCLASS_BULLET)
+        return 0;
+
+    return ammoCache[level][subClass - ITEM_SUBCLASS_ARROW];
+}
 
 void RandomItemMgr::BuildPotionCache()
 {
@@ -2349,37 +2365,38 @@ void RandomItemMgr::BuildPotionCache()
 
     ItemTemplateContainer const* itemTemplates = sObjectMgr->GetItemTemplateStore();
 
+    potionCache.assign((maxLevel + 1) / 10 + 1, {});
+
     uint32 counter = 0;
-    for (uint32 level = 1; level <= maxLevel + 1; level += 10)
+    uint32 effects[] = {SPELL_EFFECT_HEAL, SPELL_EFFECT_ENERGIZE};
+    for (auto const& itr : *itemTemplates)
     {
-        uint32 effects[] = {SPELL_EFFECT_HEAL, SPELL_EFFECT_ENERGIZE};
-        for (uint8 i = 0; i < 2; ++i)
-        {
-            uint32 effect = effects[i];
-
-            for (auto const& itr : *itemTemplates)
-            {
-                ItemTemplate const* proto = &itr.second;
-                if (!proto)
-                    continue;
+        ItemTemplate const* proto = &itr.second;
+        if (!proto)
+            continue;
 
-                if (proto->Class != ITEM_CLASS_CONSUMABLE ||
-                    (proto->SubClass != ITEM_SUBCLASS_POTION && proto->SubClass != ITEM_SUBCLASS_FLASK) ||
-                    proto->Bonding != NO_BIND)
-                    continue;
+        if (proto->Class != ITEM_CLASS_CONSUMABLE ||
+            (proto->SubClass != ITEM_SUBCLASS_POTION && proto->SubClass != ITEM_SUBCLASS_FLASK) ||
+            proto->Bonding != NO_BIND)
+            continue;
 
-                if (proto->RequiredLevel && (proto->RequiredLevel > level || proto->RequiredLevel < level - 10))
-                    continue;
+        if (proto->RequiredSkill)
+            continue;
 
-                if (proto->RequiredSkill)
-                    continue;
+        if (proto->Area || proto->Map || proto->RequiredCityRank || proto->RequiredHonorRank)
+            continue;
 
-                if (proto->Area || proto->Map || proto->RequiredCityRank || proto->RequiredHonorRank)
-                    continue;
+        if (proto->Duration & 0x80000000)
+            continue;
 
-                if (proto->Duration & 0x80000000)
-                    continue;
+        for (uint32 level = 1; level <= maxLevel + 1; level += 10)
+        {
+            if (proto->RequiredLevel && (proto->RequiredLevel > level || proto->RequiredLevel < level - 10))
+                continue;
 
+            for (uint8 e = 0; e < 2; ++e)
+            {
+                uint32 effect = effects[e];
                 for (uint8 j = 0; j < MAX_ITEM_PROTO_SPELLS; j++)
                 {
                     SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(proto->Spells[j].SpellId);
@@ -2390,7 +2407,7 @@ void RandomItemMgr::BuildPotionCache()
                     {
                         if (spellInfo->Effects[i].Effect == effect)
                         {
-                            potionCache[level / 10][effect].push_back(itr.first);
+                            potionCache[level / 10][e].push_back(itr.first);
                             break;
                         }
                     }
@@ -2405,7 +2422,7 @@ void RandomItemMgr::BuildPotionCache()
         for (uint8 i = 0; i < 2; ++i)
         {
             uint32 effect = effects[i];
-            uint32 size = potionCache[level / 10][effect].size();
+            uint32 size = potionCache[level / 10][i].size();
             ++counter;
 
             LOG_DEBUG("server.loading", "Potion cache for level={}, effect={}: {} items", level, effect, size);
@@ -2425,38 +2442,39 @@ void RandomItemMgr::BuildFoodCache()
 
     ItemTemplateContainer const* itemTemplates = sObjectMgr->GetItemTemplateStore();
 
+    foodCache.assign((maxLevel + 1) / 10 + 1, {});
+
     uint32 counter = 0;
-    for (uint32 level = 1; level <= maxLevel + 1; level += 10)
+    uint32 categories[] = {11, 59};
+    for (auto const& itr : *itemTemplates)
     {
-        uint32 categories[] = {11, 59};
-        for (int i = 0; i < 2; ++i)
-        {
-            uint32 category = categories[i];
-
-            for (auto const& itr : *itemTemplates)
-            {
-                ItemTemplate const* proto = &itr.second;
-                if (!proto)
-                    continue;
+        ItemTemplate const* proto = &itr.second;
+        if (!proto)
+            continue;
 
-                if (proto->Class != ITEM_CLASS_CONSUMABLE ||
-                    (proto->SubClass != ITEM_SUBCLASS_FOOD && proto->SubClass != ITEM_SUBCLASS_CONSUMABLE) ||
-                    (proto->Spells[0].SpellCategory != category) || proto->Bonding != NO_BIND)
-                    continue;
+        if (proto->Class != ITEM_CLASS_CONSUMABLE ||
+            (proto->SubClass != ITEM_SUBCLASS_FOOD && proto->SubClass != ITEM_SUBCLASS_CONSUMABLE) ||
+            proto->Bonding != NO_BIND)
+            continue;
 
-                if (proto->RequiredLevel && (proto->RequiredLevel > level || proto->RequiredLevel < level - 10))
-                    continue;
+        if (proto->RequiredSkill)
+            continue;
 
-                if (proto->RequiredSkill)
-                    continue;
+        if (proto->Area || proto->Map || proto->RequiredCityRank || proto->RequiredHonorRank)
+            continue;
 
-                if (proto->Area || proto->Map || proto->RequiredCityRank || proto->RequiredHonorRank)
-                    continue;
+        if (proto->Duration & 0x80000000)
+            continue;
 
-                if (proto->Duration & 0x80000000)
-                    continue;
+        for (uint32 level = 1; level <= maxLevel + 1; level += 10)
+        {
+            if (proto->RequiredLevel && (proto->RequiredLevel > level || proto->RequiredLevel < level - 10))
+                continue;
 
-                foodCache[level / 10][category].push_back(itr.first);
+            for (uint8 c = 0; c < 2; ++c)
+            {
+                if (proto->Spells[0].SpellCategory == categories[c])
+                    foodCache[level / 10][c].push_back(itr.first);
             }
         }
     }
@@ -2467,7 +2485,7 @@ void RandomItemMgr::BuildFoodCache()
         for (uint8 i = 0; i < 2; ++i)
         {
             uint32 category = categories[i];
-            uint32 size = foodCache[level / 10][category].size();
+            uint32 size = foodCache[level / 10][i].size();
             ++counter;
             LOG_DEBUG("server.loading", "Food cache for level={}, category={}: {} items", level, category, size);
         }
@@ -2476,13 +2494,24 @@ void RandomItemMgr::BuildFoodCache()
     LOG_INFO("server.loading", "Cached {} types of food", counter);
 }
 
-uint32 RandomItemMgr::GetRandomPotion(uint32 level, uint32 effect)
+uint32 RandomItemMgr::GetRandomPotion(uint32 level, uint32 effect) const
 {
-    std::vector<uint32> potions = potionCache[(level - 1) / 10][effect];
-    if (potions.empty())
+    uint32 index = (level - 1) / 10;
+    if (!level || index >= potionCache.size())
+        return 0;
+
+    std::vector<uint32> const* potions;
+    if (effect == SPELL_EFFECT_HEAL)
+        potions = &potionCache[index][0];
+    else if (effect == SPELL_EFFECT_ENERGIZE)
+        potions = &potionCache[index][1];
+    else
         return 0;
 
-    return potions[urand(0, potions.size() - 1)];
+    if (potions->empty())
+        return 0;
+
+    return (*potions)[urand(0, potions->size() - 1)];
 }
 
 uint32 RandomItemMgr::GetFood(uint32 level, uint32 category)
@@ -2539,13 +2568,24 @@ uint32 RandomItemMgr::GetFood(uint32 level, uint32 category)
     return food[urand(0, food.size() - 1)];
 }
 
-uint32 RandomItemMgr::GetRandomFood(uint32 level, uint32 category)
+uint32 RandomItemMgr::GetRandomFood(uint32 level, uint32 category) const
 {
-    std::vector<uint32> food = foodCache[(level - 1) / 10][category];
-    if (food.empty())
+    uint32 index = (level - 1) / 10;
+    if (!level || index >= foodCache.size())
         return 0;
 
-    return food[urand(0, food.size() - 1)];
+    std::vector<uint32> const* food;
+    if (category == 11)
+        food = &foodCache[index][0];
+    else if (category == 59)
+        food = &foodCache[index][1];
+    else
+        return 0;
+
+    if (food->empty())
+        return 0;
+
+    return (*food)[urand(0, food->size() - 1)];
 }
 
 void RandomItemMgr::BuildTradeCache()
@@ -2558,27 +2598,29 @@ void RandomItemMgr::BuildTradeCache()
 
     ItemTemplateContainer const* itemTemplates = sObjectMgr->GetItemTemplateStore();
 
+    tradeCache.assign((maxLevel + 1) / 10 + 1, {});
+
     uint32 counter = 0;
-    for (uint32 level = 1; level <= maxLevel + 1; level += 10)
+    for (auto const& itr : *itemTemplates)
     {
-        for (auto const& itr : *itemTemplates)
-        {
-            ItemTemplate const* proto = &itr.second;
-            if (!proto)
-                continue;
+        ItemTemplate const* proto = &itr.second;
+        if (!proto)
+            continue;
 
-            if (proto->Class != ITEM_CLASS_TRADE_GOODS || proto->Bonding != NO_BIND)
-                continue;
+        if (proto->Class != ITEM_CLASS_TRADE_GOODS || proto->Bonding != NO_BIND)
+            continue;
 
+        if (proto->RequiredSkill)
+            continue;
+
+        for (uint32 level = 1; level <= maxLevel + 1; level += 10)
+        {
             if (proto->ItemLevel < level)
                 continue;
 
             if (proto->RequiredLevel && (proto->RequiredLevel > level || proto->RequiredLevel < level - 10))
                 continue;
 
-            if (proto->RequiredSkill)
-                continue;
-
             tradeCache[level / 10].push_back(itr.first);
         }
     }
@@ -2593,9 +2635,13 @@ void RandomItemMgr::BuildTradeCache()
     LOG_INFO("server.loading", "Cached {} trade items", counter);  // TEST
 }
 
-uint32 RandomItemMgr::GetRandomTrade(uint32 level)
+uint32 RandomItemMgr::GetRandomTrade(uint32 level) const
 {
-    std::vector<uint32> trade = tradeCache[(level - 1) / 10];
+    uint32 index = (level - 1) / 10;
+    if (!level || index >= tradeCache.size())
+        return 0;
+
+    std::vector<uint32> const& trade = tradeCache[index];
     if (trade.empty())
         return 0;
 
@@ -2758,7 +2804,11 @@ void RandomItemMgr::BuildRarityCache()
     }
 }
 
-float RandomItemMgr::GetItemRarity(uint32 itemId) { return rarityCache[itemId]; }
+float RandomItemMgr::GetItemRarity(uint32 itemId) const
+{
+    auto itr = rarityCache.find(itemId);
+    return itr != rarityCache.end() ? itr->second : 0.0f;
+}
 
 inline bool IsCraftedBySpellInfo(ItemTemplate const* proto, SpellInfo const* spellInfo)
 {
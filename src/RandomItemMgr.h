@@ -6,8 +6,10 @@
 #ifndef _PLAYERBOT_RANDOMITEMMGR_H
 #define _PLAYERBOT_RANDOMITEMMGR_H
 
+#include <array>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -27,7 +29,8 @@ enum RandomItemType
     RANDOM_ITEM_GUILD_TASK_REWARD_EQUIP_BLUE,
     RANDOM_ITEM_GUILD_TASK_REWARD_EQUIP_GREEN,
     RANDOM_ITEM_GUILD_TASK_REWARD_TRADE,
-    RANDOM_ITEM_GUILD_TASK_REWARD_TRADE_RARE
+    RANDOM_ITEM_GUILD_TASK_REWARD_TRADE_RARE,
+    MAX_RANDOM_ITEM_TYPE
 };
 
 #define MAX_STAT_SCALES 32
@@ -103,7 +106,7 @@ public:
 };
 
 typedef std::vector<uint32> RandomItemList;
-typedef std::map<RandomItemType, RandomItemList> RandomItemCache;
+typedef std::array<RandomItemList, MAX_RANDOM_ITEM_TYPE> RandomItemCache;
 
 class BotEquipKey
 {
@@ -147,7 +150,7 @@ public:
     void Init();
     void InitAfterAhBot();
     static bool HandleConsoleCommand(ChatHandler* handler, char const* args);
-    RandomItemList Query(uint32 level, RandomItemType type, RandomItemPredicate* predicate);
+    RandomItemList Query(uint32 level, RandomItemType type, RandomItemPredicate* predicate) const;
     RandomItemList Query(uint32 level, uint8 clazz, uint8 slot, uint32 quality);
     uint32 GetUpgrade(Player* player, std::string spec, uint8 slot, uint32 quality, uint32 itemId);
     std::vector<uint32> GetUpgradeList(Player* player, std::string spec, uint8 slot, uint32 quality, uint32 itemId,
@@ -156,24 +159,24 @@ public:
     uint32 GetMinLevelFromCache(uint32 itemId);
     uint32 GetStatWeight(Player* player, uint32 itemId);
     uint32 GetLiveStatWeight(Player* player, uint32 itemId);
-    uint32 GetRandomItem(uint32 level, RandomItemType type, RandomItemPredicate* predicate = nullptr);
-    uint32 GetAmmo(uint32 level, uint32 subClass);
-    uint32 GetRandomPotion(uint32 level, uint32 effect);
-    uint32 GetRandomFood(uint32 level, uint32 category);
+    uint32 GetRandomItem(uint32 level, RandomItemType type, RandomItemPredicate* predicate = nullptr) const;
+    uint32 GetAmmo(uint32 level, uint32 subClass) const;
+    uint32 GetRandomPotion(uint32 level, uint32 effect) const;
+    uint32 GetRandomFood(uint32 level, uint32 category) const;
     uint32 GetFood(uint32 level, uint32 category);
-    uint32 GetRandomTrade(uint32 level);
+    uint32 GetRandomTrade(uint32 level) const;
     uint32 CalculateStatWeight(uint8 playerclass, uint8 spec, ItemTemplate const* proto);
     uint32 CalculateSingleStatWeight(uint8 playerclass, uint8 spec, std::string stat, uint32 value);
     bool CanEquipArmor(uint8 clazz, uint32 level, ItemTemplate const* proto);
     bool ShouldEquipArmorForSpec(uint8 playerclass, uint8 spec, ItemTemplate const* proto);
     bool CanEquipWeapon(uint8 clazz, ItemTemplate const* proto);
     bool ShouldEquipWeaponForSpec(uint8 playerclass, uint8 spec, ItemTemplate const* proto);
-    float GetItemRarity(uint32 itemId);
+    float GetItemRarity(uint32 itemId) const;
     uint32 GetQuestIdForItem(uint32 itemId);
     std::vector<uint32> GetQuestIdsForItem(uint32 itemId);
     static bool IsUsedBySkill(ItemTemplate const* proto, uint32 skillId);
     bool IsTestItem(uint32 itemId) { return itemForTest.find(itemId) != itemForTest.end(); }
-    std::vector<uint32> GetCachedEquipments(uint32 requiredLevel, uint32 inventoryType);
+    std::vector<uint32> const& GetCachedEquipments(uint32 requiredLevel, uint32 inventoryType) const;
 
 private:
     void BuildRandomItemCache();
@@ -189,17 +192,24 @@ private:
     bool CanEquipItemNew(ItemTemplate const* proto);
     void AddItemStats(uint32 mod, uint8& sp, uint8& ap, uint8& tank);
     bool CheckItemStats(uint8 clazz, uint8 sp, uint8 ap, uint8 tank);
+    void AddCachedEquipment(uint32 requiredLevel, ItemTemplate const* proto);
 
 private:
-    std::map<uint32, RandomItemCache> randomItemCache;
+    // Built once, read only afterwards even across config reloads, indexed by level / 10 unless noted otherwise
+    bool loaded = false;
+    bool randomItemsLoaded = false;
+    std::vector<RandomItemCache> randomItemCache;
     std::map<RandomItemType, RandomItemPredicate*> predicates;
     BotEquipCache equipCache;
     std::map<EquipmentSlots, std::set<InventoryType>> viableSlots;
-    std::map<uint32, std::map<uint32, uint32>> ammoCache;
-    std::map<uint32, std::map<uint32, std::vector<uint32>>> potionCache;
-    std::map<uint32, std::map<uint32, std::vector<uint32>>> foodCache;
-    std::map<uint32, std::vector<uint32>> tradeCache;
-    std::map<uint32, float> rarityCache;
+    // ammoCache[level][subClass - ITEM_SUBCLASS_ARROW]
+    std::vector<std::array<uint32, 2>> ammoCache;
+    // potionCache[level / 10][heal, energize]
+    std::vector<std::array<std::vector<uint32>, 2>> potionCache;
+    // foodCache[level / 10][food, drink]
+    std::vector<std::array<std::vector<uint32>, 2>> foodCache;
+    std::vector<std::vector<uint32>> tradeCache;
+    std::unordered_map<uint32, float> rarityCache;
     std::map<uint8, WeightScale> m_weightScales[MAX_CLASSES];
     std::map<std::string, uint32> weightStatLink;
     std::map<std::string, uint32> weightRatingLink;
@@ -207,7 +217,7 @@ private:
     std::unordered_set<uint32> itemForTest;
     static std::set<uint32> itemCache;
     // equipCacheNew[RequiredLevel][InventoryType]
-    std::map<uint32, std::map<uint32, std::vector<uint32>>> equipCacheNew;
+    std::vector<std::array<std::vector<uint32>, MAX_INVTYPE>> equipCacheNew;
 };
 
 #define sRandomItemMgr RandomItemMgr::instance()
@@ -18,6 +18,13 @@
  
  std::map<uint8, std::vector<uint8>> RandomPlayerbotFactory::availableRaces;
  
+ template <class T>
+ static void WaitForDatabaseQueue(DatabaseWorkerPool<T>& database)
+ {
+     while (database.QueueSize())
+         std::this_thread::sleep_for(100ms);
+ }
+ 
  constexpr RandomPlayerbotFactory::NameRaceAndGender RandomPlayerbotFactory::CombineRaceAndGender(uint8 gender,
                                                                                                   uint8 race)
  {
@@ -283,10 +290,8 @@
          botName = fields[0].Get<std::string>();
          if (ObjectMgr::CheckPlayerName(botName) == CHAR_NAME_SUCCESS)  // Checks for reservation & profanity, too
          {
-             CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHECK_NAME);
-             stmt->SetData(0, botName);
- 
-             if (PreparedQueryResult result = CharacterDatabase.Query(stmt))
+             // Also covers characters created earlier in this run that are still waiting in a batch transaction
+             if (sCharacterCache->GetCharacterGuidByName(botName))
                  continue;
              
              return botName;
@@ -399,43 +404,19 @@
      /* multi-thread here is meaningless? since the async db operations */
      if (sPlayerbotAIConfig->deleteRandomBotAccounts)
      {
-         std::vector<uint32> botAccounts;
-         std::vector<uint32> botFriends;
-         uint32 totalAccountCount = (sPlayerbotAIConfig->randomBotAccountCount != 0) ? sPlayerbotAIConfig->randomBotAccountCount 
-                                : (isWOTLK ? (sPlayerbotAIConfig->maxRandomBots / 10) : (sPlayerbotAIConfig->maxRandomBots / 9)) 
-                                + sPlayerbotAIConfig->addClassAccountPoolSize + 1;
+         std::unordered_map<std::string, uint32> botAccounts = LoadRandomBotAccountIds();
 
-         for (uint32 accountNumber = 0; accountNumber < totalAccountCount; ++accountNumber)
-         {
-             std::ostringstream out;
-             out << sPlayerbotAIConfig->randomBotAccountPrefix << accountNumber;
-             std::string const accountName = out.str();
- 
-             if (uint32 accountId = AccountMgr::GetId(accountName))
-                 botAccounts.push_back(accountId);
-         }
- 
          LOG_INFO("playerbots", "Deleting all random bot characters, {} accounts collected...", botAccounts.size());
-         QueryResult results = LoginDatabase.Query("SELECT id FROM account WHERE username LIKE '{}%%'",
-                                                   sPlayerbotAIConfig->randomBotAccountPrefix.c_str());
          int32 deletion_count = 0;
-         if (results)
+         for (auto const& [accountName, accId] : botAccounts)
          {
-             do
-             {
-                 Field* fields = results->Fetch();
-                 uint32 accId = fields[0].Get<uint32>();
-                 LOG_INFO("playerbots", "Deleting account accID: {}({})...", accId, ++deletion_count);
-                 AccountMgr::DeleteAccount(accId);
-             } while (results->NextRow());
+             LOG_INFO("playerbots", "Deleting account accID: {}({})...", accId, ++deletion_count);
+             AccountMgr::DeleteAccount(accId);
          }
  
          PlayerbotsDatabase.Execute(PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_DEL_RANDOM_BOTS));
          uint32 timer = getMSTime();
-         while (LoginDatabase.QueueSize())
-         {
-             std::this_thread::sleep_for(1s);
-         }
+         WaitForDatabaseQueue(LoginDatabase);
          LOG_INFO("playerbots", ">> Random bot accounts deleted in {} ms", GetMSTimeDiffToNow(timer));
          LOG_INFO("playerbots", "Please reset the AiPlayerbot.DeleteRandomBotAccounts to 0 and restart the server...");
          World::StopNow(SHUTDOWN_EXIT_CODE);
@@ -444,25 +425,29 @@
  
      LOG_INFO("playerbots", "Creating random bot accounts...");
      std::unordered_map<NameRaceAndGender, std::vector<std::string>> nameCache;
-     std::vector<std::future<void>> account_creations;
-     int account_creation = 0;
      uint32 totalAccountCount = (sPlayerbotAIConfig->randomBotAccountCount != 0) ? sPlayerbotAIConfig->randomBotAccountCount 
                             : (isWOTLK ? (sPlayerbotAIConfig->maxRandomBots / 10) : (sPlayerbotAIConfig->maxRandomBots / 9)) 
                             + sPlayerbotAIConfig->addClassAccountPoolSize + 1;
 
+     std::vector<std::string> accountNames;
+     accountNames.reserve(totalAccountCount);
      for (uint32 accountNumber = 0; accountNumber < totalAccountCount; ++accountNumber)
      {
          std::ostringstream out;
          out << sPlayerbotAIConfig->randomBotAccountPrefix << accountNumber;
-         std::string const accountName = out.str();
+         std::string accountName = out.str();
+         Utf8ToUpperOnlyLatin(accountName);
+         accountNames.push_back(accountName);
+     }
  
-         LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_GET_ACCOUNT_ID_BY_USERNAME);
-         stmt->SetData(0, accountName);
-         PreparedQueryResult result = LoginDatabase.Query(stmt);
-         if (result)
-         {
+     std::unordered_map<std::string, uint32> accountIds = LoadRandomBotAccountIds();
+     int account_creation = 0;
+     uint32 timer = getMSTime();
+     for (std::string const& accountName : accountNames)
+     {
+         if (accountIds.find(accountName) != accountIds.end())
              continue;
-         }
+ 
          account_creation++;
          std::string password = "";
          if (sPlayerbotAIConfig->randomBotRandomPassword)
@@ -484,39 +469,36 @@
      {
          LOG_INFO("playerbots", "Waiting for {} accounts loading into database ({} queries)...", account_creation, LoginDatabase.QueueSize());
          /* wait for async accounts create to make character create correctly */
-         uint32 timer = getMSTime();
-         while (LoginDatabase.QueueSize())
-         {
-             std::this_thread::sleep_for(1s);
-         }
-         LOG_INFO("playerbots", ">> {} Accounts loaded into database in {} ms", account_creation, GetMSTimeDiffToNow(timer));
+         WaitForDatabaseQueue(LoginDatabase);
+         uint32 elapsed = std::max<uint32>(GetMSTimeDiffToNow(timer), 1);
+         LOG_INFO("playerbots", ">> {} Accounts loaded into database in {} ms ({} per second)", account_creation, elapsed,
+                  account_creation * 1000 / elapsed);
+         accountIds = LoadRandomBotAccountIds();
+     }
+ 
+     for (std::string const& accountName : accountNames)
+     {
+         auto itr = accountIds.find(accountName);
+         if (itr != accountIds.end())
+             sPlayerbotAIConfig->randomBotAccounts.push_back(itr->second);
      }
  
      LOG_INFO("playerbots", "Creating random bot characters...");
-     uint32 totalRandomBotChars = 0;
-     std::vector<std::pair<Player*, uint32>> playerBots;
+     std::unordered_map<uint32, uint32> charCounts = LoadCharacterCounts(sPlayerbotAIConfig->randomBotAccounts);
      std::vector<WorldSession*> sessionBots;
      int bot_creation = 0;
  
+     // Characters are saved in batches, one transaction per batch instead of one per character
+     uint32 const charactersPerTransaction = 100;
+     CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+     uint32 pendingCharacters = 0;
+ 
      bool nameCached = false;
-     for (uint32 accountNumber = 0; accountNumber < totalAccountCount; ++accountNumber)
+     timer = getMSTime();
+     for (uint32 accountIndex = 0; accountIndex < sPlayerbotAIConfig->randomBotAccounts.size(); ++accountIndex)
      {
-         std::ostringstream out;
-         out << sPlayerbotAIConfig->randomBotAccountPrefix << accountNumber;
-         std::string const accountName = out.str();
- 
-         LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_GET_ACCOUNT_ID_BY_USERNAME);
-         stmt->SetData(0, accountName);
-         PreparedQueryResult result = LoginDatabase.Query(stmt);
-         if (!result)
-             continue;
- 
-         Field* fields = result->Fetch();
-         uint32 accountId = fields[0].Get<uint32>();
- 
-         sPlayerbotAIConfig->randomBotAccounts.push_back(accountId);
- 
-         uint32 count = AccountMgr::GetCharactersCount(accountId);
+         uint32 accountId = sPlayerbotAIConfig->randomBotAccounts[accountIndex];
+         uint32 count = charCounts[accountId];
          if (count >= 10)
          {
              continue;
@@ -526,7 +508,11 @@
          {
              nameCached = true;
              LOG_INFO("playerbots", "Creating cache for names per gender and race...");
-             QueryResult result = CharacterDatabase.Query("SELECT name, gender FROM playerbots_names");
+             QueryResult result = CharacterDatabase.Query(
+                 "SELECT n.name, n.gender "
+                 "FROM playerbots_names n "
+                 "LEFT OUTER JOIN characters c ON c.name = n.name "
+                 "WHERE c.guid IS NULL");
              if (!result)
              {
                  LOG_ERROR("playerbots", "No more unused names left");
@@ -538,20 +524,12 @@
                  std::string name = fields[0].Get<std::string>();
                  NameRaceAndGender raceAndGender = static_cast<NameRaceAndGender>(fields[1].Get<uint8>());
                  if (sObjectMgr->CheckPlayerName(name) == CHAR_NAME_SUCCESS)
-                 {
-                     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHECK_NAME);
-                     stmt->SetData(0, name);
- 
-                     if (PreparedQueryResult result = CharacterDatabase.Query(stmt))
-                         continue;
-                     
                      nameCache[raceAndGender].push_back(name);
-                 }
  
              } while (result->NextRow());
          }
          
-         LOG_DEBUG("playerbots", "Creating random bot characters for account: [{}/{}]", accountNumber + 1, totalAccountCount);
+         LOG_DEBUG("playerbots", "Creating random bot characters for account: [{}/{}]", accountIndex + 1, sPlayerbotAIConfig->randomBotAccounts.size());
          RandomPlayerbotFactory factory(accountId);
  
          WorldSession* session = new WorldSession(accountId, "", nullptr, SEC_PLAYER, EXPANSION_WRATH_OF_THE_LICH_KING,
@@ -574,13 +552,14 @@
              {
                  if (Player* playerBot = factory.CreateRandomBot(session, cls, nameCache))
                  {
-                     playerBot->SaveToDB(true, false);
+                     playerBot->SaveToDB(trans, true, false);
                      sCharacterCache->AddCharacterCacheEntry(playerBot->GetGUID(), accountId, playerBot->GetName(),
                                                              playerBot->getGender(), playerBot->getRace(),
                                                              playerBot->getClass(), playerBot->GetLevel());
                      playerBot->CleanupsBeforeDelete();
                      delete playerBot;
                      bot_creation++;
+                     pendingCharacters++;
                  }
                  else
                  {
@@ -588,32 +567,91 @@
                  }
              }
          }
+ 
+         if (pendingCharacters >= charactersPerTransaction)
+         {
+             CharacterDatabase.CommitTransaction(trans);
+             trans = CharacterDatabase.BeginTransaction();
+             pendingCharacters = 0;
+             LOG_INFO("playerbots", "Random bot characters: {} created, {}/{} accounts processed", bot_creation,
+                      accountIndex + 1, sPlayerbotAIConfig->randomBotAccounts.size());
+         }
      }
  
+     if (pendingCharacters)
+         CharacterDatabase.CommitTransaction(trans);
+ 
      if (bot_creation)
      {
          LOG_INFO("playerbots", "Waiting for {} characters loading into database ({} queries)...", bot_creation, CharacterDatabase.QueueSize());
          /* wait for characters load into database, or characters will fail to loggin */
-         uint32 timer = getMSTime();
-         while (CharacterDatabase.QueueSize())
-         {
-             std::this_thread::sleep_for(1s);
-         }
-         LOG_INFO("playerbots", ">> {} Characters loaded into database in {} ms", bot_creation, GetMSTimeDiffToNow(timer));
+         WaitForDatabaseQueue(CharacterDatabase);
+         uint32 elapsed = std::max<uint32>(GetMSTimeDiffToNow(timer), 1);
+         LOG_INFO("playerbots", ">> {} Characters loaded into database in {} ms ({} per second)", bot_creation, elapsed,
+                  bot_creation * 1000 / elapsed);
+         charCounts = LoadCharacterCounts(sPlayerbotAIConfig->randomBotAccounts);
      }
  
      for (WorldSession* session : sessionBots)
          delete session;
  
-     for (uint32 accountId : sPlayerbotAIConfig->randomBotAccounts)
-     {
-         totalRandomBotChars += AccountMgr::GetCharactersCount(accountId);
-     }
+     uint32 totalRandomBotChars = 0;
+     for (auto const& [accountId, count] : charCounts)
+         totalRandomBotChars += count;
  
      LOG_INFO("server.loading", ">> {} random bot accounts with {} characters available",
               sPlayerbotAIConfig->randomBotAccounts.size(), totalRandomBotChars);
  }
  
+ std::unordered_map<std::string, uint32> RandomPlayerbotFactory::LoadRandomBotAccountIds()
+ {
+     std::unordered_map<std::string, uint32> accountIds;
+ 
+     QueryResult result = LoginDatabase.Query("SELECT id, username FROM account WHERE username LIKE '{}%%'",
+                                              sPlayerbotAIConfig->randomBotAccountPrefix.c_str());
+     if (!result)
+         return accountIds;
+ 
+     do
+     {
+         Field* fields = result->Fetch();
+         std::string username = fields[1].Get<std::string>();
+         Utf8ToUpperOnlyLatin(username);
+         accountIds[username] = fields[0].Get<uint32>();
+     } while (result->NextRow());
+ 
+     return accountIds;
+ }
+ 
+ std::unordered_map<uint32, uint32> RandomPlayerbotFactory::LoadCharacterCounts(std::vector<uint32> const& accounts)
+ {
+     std::unordered_map<uint32, uint32> counts;
+ 
+     // Chunked so the IN list stays a reasonable size for large bot populations
+     uint32 const accountsPerQuery = 1000;
+     for (size_t begin = 0; begin < accounts.size(); begin += accountsPerQuery)
+     {
+         size_t end = std::min<size_t>(begin + accountsPerQuery, accounts.size());
+ 
+         std::ostringstream ids;
+         for (size_t i = begin; i < end; ++i)
+             ids << (i == begin ? "" : ",") << accounts[i];
+ 
+         QueryResult result = CharacterDatabase.Query(
+             "SELECT account, COUNT(guid) FROM characters WHERE account IN ({}) GROUP BY account", ids.str());
+         if (!result)
+             continue;
+ 
+         do
+         {
+             Field* fields = result->Fetch();
+             counts[fields[0].Get<uint32>()] = fields[1].Get<uint32>();
+         } while (result->NextRow());
+     }
+ 
+     return counts;
+ }
+ 
  void RandomPlayerbotFactory::CreateRandomGuilds()
  {
      std::vector<uint32> randomBots;
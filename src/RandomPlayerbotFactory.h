@@ -57,6 +57,8 @@ public:
 
 private:
     std::string const CreateRandomBotName(NameRaceAndGender raceAndGender);
+    static std::unordered_map<std::string, uint32> LoadRandomBotAccountIds();
+    static std::unordered_map<uint32, uint32> LoadCharacterCounts(std::vector<uint32> const& accounts);
     static std::string const CreateRandomArenaTeamName();
 
     uint32 accountId;
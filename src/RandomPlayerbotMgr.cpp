@@ -382,7 +382,9 @@ void RandomPlayerbotMgr::UpdateAIInternal(uint32 elapsed, bool /*minimal*/)
         }
     }
     uint32 updateBots = sPlayerbotAIConfig->randomBotsPerInterval * onlineBotFocus / 100;
-    uint32 maxNewBots = onlineBotCount < maxAllowedBotCount ? maxAllowedBotCount - onlineBotCount : 0;
+    // bots still logging in are not in playerBots yet but count against the limit
+    uint32 activeBotCount = onlineBotCount + botLoading.size();
+    uint32 maxNewBots = activeBotCount < maxAllowedBotCount ? maxAllowedBotCount - activeBotCount : 0;
     uint32 loginBots = std::min(sPlayerbotAIConfig->randomBotsPerInterval - updateBots, maxNewBots);
 
     if (!availableBots.empty())
@@ -402,10 +404,13 @@ void RandomPlayerbotMgr::UpdateAIInternal(uint32 elapsed, bool /*minimal*/)
                 break;
         }
 
-        if (loginBots && botLoading.empty())
+        uint32 loginCapacity = botLoading.size() < sPlayerbotAIConfig->maxConcurrentBotLogins
+                                   ? sPlayerbotAIConfig->maxConcurrentBotLogins - botLoading.size()
+                                   : 0;
+        if (loginBots && loginCapacity)
         {
             loginBots += updateBots;
-            loginBots = std::min(loginBots, maxNewBots);
+            loginBots = std::min({loginBots, maxNewBots, loginCapacity});
 
             LOG_INFO("playerbots", "{} new bots", loginBots);
 
@@ -415,6 +420,9 @@ void RandomPlayerbotMgr::UpdateAIInternal(uint32 elapsed, bool /*minimal*/)
                 if (GetPlayerBot(bot))
                     continue;
 
+                if (botLoading.find(ObjectGuid::Create<HighGuid::Player>(bot)) != botLoading.end())
+                    continue;
+
                 if (ProcessBot(bot))
                 {
                     loginBots--;
@@ -2908,7 +2916,41 @@ std::string const RandomPlayerbotMgr::HandleRemoteCommand(std::string const requ
     }
 
     std::string const command = std::string(request.begin(), pos);
-    ObjectGuid guid = ObjectGuid::Create<HighGuid::Player>(atoi(std::string(pos + 1, request.end()).c_str()));
+    std::string const targets = std::string(pos + 1, request.end());
+
+    // batch: "command,guid1,guid2,..." or "command,*" for every random bot,
+    // answered with a count line followed by one "guid,response" line per bot
+    if (targets == "*" || targets.find(',') != std::string::npos)
+    {
+        std::vector<ObjectGuid::LowType> guids;
+        if (targets == "*")
+        {
+            guids.reserve(playerBots.size());
+            for (auto const& itr : playerBots)
+                guids.push_back(itr.first.GetCounter());
+        }
+        else
+        {
+            std::istringstream in(targets);
+            std::string token;
+            while (std::getline(in, token, ','))
+                guids.push_back(atoi(token.c_str()));
+        }
+
+        std::ostringstream out;
+        out << guids.size();
+        for (ObjectGuid::LowType lowGuid : guids)
+            out << "\n" << lowGuid << "," << HandleRemoteCommand(command, lowGuid);
+
+        return out.str();
+    }
+
+    return HandleRemoteCommand(command, atoi(targets.c_str()));
+}
+
+std::string const RandomPlayerbotMgr::HandleRemoteCommand(std::string const& command, ObjectGuid::LowType lowGuid)
+{
+    ObjectGuid guid = ObjectGuid::Create<HighGuid::Player>(lowGuid);
     Player* bot = GetPlayerBot(guid);
     if (!bot)
         return "invalid guid";
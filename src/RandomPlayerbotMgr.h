@@ -121,6 +121,7 @@ public:
     void ScheduleChangeStrategy(uint32 bot, uint32 time = 0);
     void HandleCommand(uint32 type, std::string const text, Player* fromPlayer, std::string channelName = "");
     std::string const HandleRemoteCommand(std::string const request);
+    std::string const HandleRemoteCommand(std::string const& command, ObjectGuid::LowType lowGuid);
     void OnPlayerLogout(Player* player);
     void OnPlayerLogin(Player* player);
     void OnPlayerLoginError(uint32 bot);
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#include "SpellNameIndex.h"
+
+#include "Log.h"
+#include "SpellInfo.h"
+#include "SpellMgr.h"
+#include "Util.h"
+
+void SpellNameIndex::Init()
+{
+    // Bots keep pointers into the table, the spell store does not change on config reload
+    if (!spellsByName.empty())
+        return;
+
+    for (uint32 spellId = 0; spellId < sSpellMgr->GetSpellInfoStoreSize(); ++spellId)
+    {
+        SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
+        if (!spellInfo || !spellInfo->SpellName[0] || !*spellInfo->SpellName[0])
+            continue;
+
+        std::string const name = Normalize(spellInfo->SpellName[0]);
+        if (!name.empty())
+            spellsByName[name].push_back(spellId);
+    }
+
+    LOG_INFO("playerbots", "Indexed {} spell names", spellsByName.size());
+}
+
+std::vector<uint32> const& SpellNameIndex::GetSpellIds(std::string const& name) const
+{
+    static std::vector<uint32> const empty;
+
+    auto itr = spellsByName.find(Normalize(name));
+    return itr != spellsByName.end() ? itr->second : empty;
+}
+
+std::string SpellNameIndex::Normalize(std::string const& name)
+{
+    std::wstring wname;
+    if (!Utf8toWStr(name, wname))
+        return "";
+
+    wstrToLower(wname);
+
+    std::string normalized;
+    if (!WStrToUtf8(wname, normalized))
+        return "";
+
+    return normalized;
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#ifndef _PLAYERBOT_SPELLNAMEINDEX_H
+#define _PLAYERBOT_SPELLNAMEINDEX_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Common.h"
+
+// Lowercased English spell name -> every spell id carrying that name, built once at startup so strategies can keep
+// naming their buffs and debuffs without comparing names against every aura or spell book entry.
+class SpellNameIndex
+{
+public:
+    SpellNameIndex() {}
+    virtual ~SpellNameIndex() {}
+    static SpellNameIndex* instance()
+    {
+        static SpellNameIndex instance;
+        return &instance;
+    }
+
+    void Init();
+
+    // Sorted by spell id, empty if no spell has this name
+    std::vector<uint32> const& GetSpellIds(std::string const& name) const;
+
+    static std::string Normalize(std::string const& name);
+
+private:
+    std::unordered_map<std::string, std::vector<uint32>> spellsByName;
+};
+
+#define sSpellNameIndex SpellNameIndex::instance()
+
+#endif
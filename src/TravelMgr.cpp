@@ -13,6 +13,7 @@
 #include "MMapFactory.h"
 #include "MapMgr.h"
 #include "PathGenerator.h"
+#include "QuestIndex.h"
 #include "Playerbots.h"
 #include "StrategyContext.h"
 #include "TransportMgr.h"
@@ -1944,7 +1945,7 @@ void TravelMgr::LoadQuestTravelTable()
     bool loadQuestData = true;
     if (loadQuestData)
     {
-        questGuidpMap questMap = GAI_VALUE(questGuidpMap, "quest guidp map");
+        questGuidpMap const& questMap = sQuestIndex->GetQuestGuidpMap();
 
         for (auto& q : questMap)
         {
@@ -13,6 +13,8 @@
  * with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <sstream>
+
 #include "BattleGroundTactics.h"
 #include "Chat.h"
 #include "GuildTaskMgr.h"
@@ -83,6 +85,30 @@ public:
             return true;
         }
 
+        if (!strcmp(args, "bench") || !strncmp(args, "bench ", 6))
+        {
+            // pmon bench [seconds]
+            std::istringstream in(args + 5);
+            uint32 seconds = 60;
+            std::string secondsArg;
+            std::string extra;
+            if (in >> secondsArg)
+            {
+                if (secondsArg.find_first_not_of("0123456789") != std::string::npos || secondsArg.size() > 6 ||
+                    in >> extra)
+                {
+                    handler->SendSysMessage("Usage: .playerbots pmon bench [seconds]");
+                    handler->SetSentErrorMessage(true);
+                    return false;
+                }
+
+                seconds = std::stoul(secondsArg);
+            }
+
+            sPerformanceMonitor->StartBenchmark(seconds * IN_MILLISECONDS);
+            return true;
+        }
+
         if (!strcmp(args, "toggle"))
         {
             sPlayerbotAIConfig->perfMonEnabled = !sPlayerbotAIConfig->perfMonEnabled;
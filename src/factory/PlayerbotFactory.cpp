@@ -1558,39 +1558,43 @@ void Shuffle(std::vector<uint32>& items)
 
 void PlayerbotFactory::InitEquipment(bool incremental, bool second_chance)
 {
-    std::unordered_map<uint8, std::vector<uint32>> items;
-    // int tab = AiFactory::GetPlayerSpecTab(bot);
+    ApplyEquipmentPlan(PlanEquipment(), incremental, second_chance);
+}
 
-    uint32 blevel = bot->GetLevel();
-    int32 delta = std::min(blevel, 10u);
+bool PlayerbotFactory::SkipEquipmentSlot(int32 slot)
+{
+    if (slot == EQUIPMENT_SLOT_TABARD || slot == EQUIPMENT_SLOT_BODY)
+        return true;
 
-    StatsWeightCalculator calculator(bot);
-    // Reverse order may work better
-    for (int32 slot = (int32)EQUIPMENT_SLOT_TABARD; slot >= (int32)EQUIPMENT_SLOT_START; slot--)
-    {
-        if (slot == EQUIPMENT_SLOT_TABARD || slot == EQUIPMENT_SLOT_BODY)
-            continue;
+    if (level < 50 && (slot == EQUIPMENT_SLOT_TRINKET1 || slot == EQUIPMENT_SLOT_TRINKET2))
+        return true;
 
-        if (level < 50 && (slot == EQUIPMENT_SLOT_TRINKET1 || slot == EQUIPMENT_SLOT_TRINKET2))
-            continue;
+    if (level < 30 && slot == EQUIPMENT_SLOT_NECK)
+        return true;
 
-        if (level < 30 && slot == EQUIPMENT_SLOT_NECK)
-            continue;
+    if (level < 25 && slot == EQUIPMENT_SLOT_HEAD)
+        return true;
 
-        if (level < 25 && slot == EQUIPMENT_SLOT_HEAD)
-            continue;
+    if (level < 20 && (slot == EQUIPMENT_SLOT_FINGER1 || slot == EQUIPMENT_SLOT_FINGER2))
+        return true;
 
-        if (level < 20 && (slot == EQUIPMENT_SLOT_FINGER1 || slot == EQUIPMENT_SLOT_FINGER2))
-            continue;
+    return false;
+}
 
-        Item* oldItem = bot->GetItemByPos(INVENTORY_SLOT_BAG_0, slot);
+EquipmentPlan PlayerbotFactory::PlanEquipment()
+{
+    EquipmentPlan plan;
+    // int tab = AiFactory::GetPlayerSpecTab(bot);
 
-        if (second_chance && oldItem)
-        {
-            bot->DestroyItem(INVENTORY_SLOT_BAG_0, slot, true);
-        }
+    uint32 blevel = bot->GetLevel();
+    int32 delta = std::min(blevel, 10u);
 
-        oldItem = bot->GetItemByPos(INVENTORY_SLOT_BAG_0, slot);
+    for (int32 slot = (int32)EQUIPMENT_SLOT_TABARD; slot >= (int32)EQUIPMENT_SLOT_START; slot--)
+    {
+        if (SkipEquipmentSlot(slot))
+            continue;
+
+        std::vector<uint32>& ids = plan.candidates[slot];
 
         uint32 desiredQuality = itemQuality;
         if (urand(0, 100) < 100 * sPlayerbotAIConfig->randomGearLoweringChance && desiredQuality > ITEM_QUALITY_NORMAL)
@@ -1599,8 +1603,7 @@ void PlayerbotFactory::InitEquipment(bool incremental, bool second_chance)
         }
         do
         {
-            for (uint32 requiredLevel = bot->GetLevel(); requiredLevel > std::max((int32)bot->GetLevel() - delta, 0);
-                 requiredLevel--)
+            for (uint32 requiredLevel = blevel; requiredLevel > std::max((int32)blevel - delta, 0); requiredLevel--)
             {
                 for (InventoryType inventoryType : GetPossibleInventoryTypeListBySlot((EquipmentSlots)slot))
                 {
@@ -1615,10 +1618,10 @@ void PlayerbotFactory::InitEquipment(bool incremental, bool second_chance)
                             continue;
 
                         // disable next expansion gear
-                        if (sPlayerbotAIConfig->limitGearExpansion && bot->GetLevel() <= 60 && itemId >= 23728)
+                        if (sPlayerbotAIConfig->limitGearExpansion && blevel <= 60 && itemId >= 23728)
                             continue;
 
-                        if (sPlayerbotAIConfig->limitGearExpansion && bot->GetLevel() <= 70 && itemId >= 35570 &&
+                        if (sPlayerbotAIConfig->limitGearExpansion && blevel <= 70 && itemId >= 35570 &&
                             itemId != 36737 && itemId != 37739 &&
                             itemId != 37740)  // transition point from TBC -> WOTLK isn't as clear, and there are other
                                               // wearable TBC items above 35570 but nothing of significance
@@ -1659,46 +1662,76 @@ void PlayerbotFactory::InitEquipment(bool incremental, bool second_chance)
                         // delay heavy check
                         // uint16 dest = 0;
                         // if (CanEquipUnseenItem(slot, dest, itemId))
-                        items[slot].push_back(itemId);
+                        ids.push_back(itemId);
                     }
                 }
             }
-        } while (items[slot].size() < 25 && desiredQuality-- > ITEM_QUALITY_NORMAL);
+        } while (ids.size() < 25 && desiredQuality-- > ITEM_QUALITY_NORMAL);
+    }
 
-        std::vector<uint32>& ids = items[slot];
-        if (ids.empty())
-        {
+    return plan;
+}
+
+uint32 PlayerbotFactory::FindBestEquipment(std::vector<uint32> const& ids, uint8 slot,
+                                           StatsWeightCalculator& calculator, uint16& dest, float& bestScore)
+{
+    // score every candidate once, then run the heavy checks from the best one down
+    std::vector<std::pair<float, uint32>> scored;
+    scored.reserve(ids.size());
+    for (uint32 itemId : ids)
+        scored.emplace_back(calculator.CalculateItem(itemId), itemId);
+
+    std::stable_sort(scored.begin(), scored.end(),
+                     [](std::pair<float, uint32> const& lhs, std::pair<float, uint32> const& rhs)
+                     { return lhs.first > rhs.first; });
+
+    for (auto const& [score, itemId] : scored)
+    {
+        if (score <= -1)
+            break;
+
+        // delay heavy check to here
+        if (!CanEquipItem(sObjectMgr->GetItemTemplate(itemId)))
             continue;
-        }
 
-        float bestScoreForSlot = -1;
-        uint32 bestItemForSlot = 0;
-        for (int index = 0; index < ids.size(); index++)
-        {
-            uint32 newItemId = ids[index];
+        if (!CanEquipUnseenItem(slot, dest, itemId))
+            continue;
 
-            ItemTemplate const* proto = sObjectMgr->GetItemTemplate(newItemId);
+        bestScore = score;
+        return itemId;
+    }
 
-            float cur_score = calculator.CalculateItem(newItemId);
-            if (cur_score > bestScoreForSlot)
-            {
-                // delay heavy check to here
-                if (!CanEquipItem(proto))
-                    continue;
-                uint16 dest;
-                if (!CanEquipUnseenItem(slot, dest, newItemId))
-                    continue;
-                bestScoreForSlot = cur_score;
-                bestItemForSlot = newItemId;
-            }
+    return 0;
+}
+
+void PlayerbotFactory::ApplyEquipmentPlan(EquipmentPlan const& plan, bool incremental, bool second_chance)
+{
+    StatsWeightCalculator calculator(bot);
+    // Reverse order may work better
+    for (int32 slot = (int32)EQUIPMENT_SLOT_TABARD; slot >= (int32)EQUIPMENT_SLOT_START; slot--)
+    {
+        if (SkipEquipmentSlot(slot))
+            continue;
+
+        Item* oldItem = bot->GetItemByPos(INVENTORY_SLOT_BAG_0, slot);
+
+        if (second_chance && oldItem)
+        {
+            bot->DestroyItem(INVENTORY_SLOT_BAG_0, slot, true);
         }
 
-        if (bestItemForSlot == 0)
+        oldItem = bot->GetItemByPos(INVENTORY_SLOT_BAG_0, slot);
+
+        std::vector<uint32> const& ids = plan.candidates[slot];
+        if (ids.empty())
         {
             continue;
         }
+
         uint16 dest;
-        if (!CanEquipUnseenItem(slot, dest, bestItemForSlot))
+        float bestScoreForSlot = -1;
+        uint32 bestItemForSlot = FindBestEquipment(ids, slot, calculator, dest, bestScoreForSlot);
+        if (bestItemForSlot == 0)
         {
             continue;
         }
@@ -1734,64 +1767,27 @@ void PlayerbotFactory::InitEquipment(bool incremental, bool second_chance)
         // }
     }
     // Secondary init for better equips
-    /// @todo: clean up duplicate code
     if (second_chance)
     {
         for (int32 slot = (int32)EQUIPMENT_SLOT_TABARD; slot >= (int32)EQUIPMENT_SLOT_START; slot--)
         {
-            if (slot == EQUIPMENT_SLOT_TABARD || slot == EQUIPMENT_SLOT_BODY)
-                continue;
-
-            if (level < 50 && (slot == EQUIPMENT_SLOT_TRINKET1 || slot == EQUIPMENT_SLOT_TRINKET2))
-                continue;
-
-            if (level < 30 && slot == EQUIPMENT_SLOT_NECK)
-                continue;
-
-            if (level < 25 && slot == EQUIPMENT_SLOT_HEAD)
-                continue;
-
-            if (level < 20 && (slot == EQUIPMENT_SLOT_FINGER1 || slot == EQUIPMENT_SLOT_FINGER2))
+            if (SkipEquipmentSlot(slot))
                 continue;
 
             if (Item* oldItem = bot->GetItemByPos(INVENTORY_SLOT_BAG_0, slot))
                 bot->DestroyItem(INVENTORY_SLOT_BAG_0, slot, true);
 
-            std::vector<uint32>& ids = items[slot];
+            std::vector<uint32> const& ids = plan.candidates[slot];
             if (ids.empty())
                 continue;
 
+            uint16 dest;
             float bestScoreForSlot = -1;
-            uint32 bestItemForSlot = 0;
-            for (int index = 0; index < ids.size(); index++)
-            {
-                uint32 newItemId = ids[index];
-
-                ItemTemplate const* proto = sObjectMgr->GetItemTemplate(newItemId);
-
-                float cur_score = calculator.CalculateItem(newItemId);
-                if (cur_score > bestScoreForSlot)
-                {
-                    // delay heavy check to here
-                    if (!CanEquipItem(proto))
-                        continue;
-                    uint16 dest;
-                    if (!CanEquipUnseenItem(slot, dest, newItemId))
-                        continue;
-                    bestScoreForSlot = cur_score;
-                    bestItemForSlot = newItemId;
-                }
-            }
-
+            uint32 bestItemForSlot = FindBestEquipment(ids, slot, calculator, dest, bestScoreForSlot);
             if (bestItemForSlot == 0)
             {
                 continue;
             }
-            uint16 dest;
-            if (!CanEquipUnseenItem(slot, dest, bestItemForSlot))
-            {
-                continue;
-            }
             Item* newItem = bot->EquipNewItem(dest, bestItemForSlot, true);
             bot->AutoUnequipOffhandIfNeed();
             // if (newItem)
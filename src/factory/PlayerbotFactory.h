@@ -11,9 +11,17 @@
 #include "PlayerbotAI.h"
 
 class Item;
+class StatsWeightCalculator;
 
 struct ItemTemplate;
 
+// Gear candidates per equipment slot. Built only from item templates and the bot's class, level and skills,
+// so it can be computed ahead of the apply step that creates and equips the items.
+struct EquipmentPlan
+{
+    std::vector<uint32> candidates[EQUIPMENT_SLOT_END];
+};
+
 struct EnchantTemplate
 {
     uint8 ClassId;
@@ -123,6 +131,8 @@ public:
     void InitAvailableSpells();
     void InitClassSpells();
     void InitEquipment(bool incremental, bool second_chance = false);
+    EquipmentPlan PlanEquipment();
+    void ApplyEquipmentPlan(EquipmentPlan const& plan, bool incremental, bool second_chance = false);
     void InitPet();
     void InitAmmo();
     static uint32 CalcMixedGearScore(uint32 gs, uint32 quality);
@@ -143,6 +153,9 @@ private:
     // void InitEquipmentNew(bool incremental);
     bool CanEquipItem(ItemTemplate const* proto);
     bool CanEquipUnseenItem(uint8 slot, uint16& dest, uint32 item);
+    bool SkipEquipmentSlot(int32 slot);
+    uint32 FindBestEquipment(std::vector<uint32> const& ids, uint8 slot, StatsWeightCalculator& calculator,
+                             uint16& dest, float& bestScore);
     void InitTradeSkills();
     void UpdateTradeSkills();
     void SetRandomSkill(uint16 id);
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#include "DecisionTrace.h"
+
+#include <iomanip>
+#include <sstream>
+
+#include "Action.h"
+#include "Timer.h"
+
+void DecisionTrace::Record(Action* action, std::string const& trigger, float relevance, DecisionOutcome outcome)
+{
+    records[next] = {getMSTime(), action, &trigger, relevance, outcome};
+    next = (next + 1) % SIZE;
+    if (size < SIZE)
+        ++size;
+}
+
+std::vector<std::string> DecisionTrace::Decode(uint32 count) const
+{
+    static char const* const outcomes[] = {"OK", "FAILED", "IMPOSSIBLE", "USELESS", "PREREQ"};
+
+    std::vector<std::string> lines;
+    uint32 const now = getMSTime();
+    for (uint32 i = 0; i < std::min(count, size); ++i)
+    {
+        DecisionRecord const& record = records[(next + SIZE - 1 - i) % SIZE];
+
+        std::ostringstream out;
+        out << "-" << std::fixed << std::setprecision(1) << getMSTimeDiff(record.time, now) / 1000.0f << "s "
+            << record.action->getName() << " " << outcomes[record.outcome] << " (" << std::setprecision(3)
+            << record.relevance << ")";
+
+        if (!record.trigger->empty())
+            out << " [" << *record.trigger << "]";
+
+        lines.push_back(out.str());
+    }
+
+    return lines;
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#ifndef _PLAYERBOT_DECISIONTRACE_H
+#define _PLAYERBOT_DECISIONTRACE_H
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "Common.h"
+
+class Action;
+
+enum DecisionOutcome : uint8
+{
+    DECISION_OK,
+    DECISION_FAILED,
+    DECISION_IMPOSSIBLE,
+    DECISION_USELESS,
+    DECISION_PREREQ
+};
+
+struct DecisionRecord
+{
+    uint32 time;
+    Action* action;
+    std::string const* trigger;
+    float relevance;
+    DecisionOutcome outcome;
+};
+
+// The last decisions of a bot's engines, recorded without formatting. Actions are owned by the bot's
+// AiObjectContext and trigger names are interned by Event, so both outlive the records pointing at them.
+class DecisionTrace
+{
+public:
+    static constexpr uint32 SIZE = 128;
+
+    void Record(Action* action, std::string const& trigger, float relevance, DecisionOutcome outcome);
+    // Newest first, at most count entries
+    std::vector<std::string> Decode(uint32 count) const;
+    uint32 Size() const { return size; }
+
+private:
+    std::array<DecisionRecord, SIZE> records;
+    uint32 next = 0;
+    uint32 size = 0;
+};
+
+#endif
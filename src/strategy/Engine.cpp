@@ -12,7 +12,8 @@
 #include "Queue.h"
 #include "Strategy.h"
 
-Engine::Engine(PlayerbotAI* botAI, AiObjectContext* factory) : PlayerbotAIAware(botAI), aiObjectContext(factory)
+Engine::Engine(PlayerbotAI* botAI, AiObjectContext* factory)
+    : PlayerbotAIAware(botAI), trace(botAI->GetDecisionTrace()), aiObjectContext(factory)
 {
     lastRelevance = 0.0f;
     testMode = false;
@@ -87,6 +88,7 @@ Engine::~Engine(void)
 void Engine::Reset()
 {
     strategyTypeMask = 0;
+    debugStrategy = false;
     ActionNode* action = nullptr;
     do
     {
@@ -122,6 +124,7 @@ void Engine::Init()
     {
         Strategy* strategy = i->second;
         strategyTypeMask |= strategy->GetType();
+        debugStrategy |= i->first == "debug";
         strategy->InitMultipliers(multipliers);
         strategy->InitTriggers(triggers);
 
@@ -139,7 +142,12 @@ void Engine::Init()
 
 bool Engine::DoNextAction(Unit* unit, uint32 depth, bool minimal)
 {
-    LogAction("--- AI Tick ---");
+    Player* bot = botAI->GetBot();
+    logActions = testMode || (sLog->ShouldLog("playerbots", LOG_LEVEL_DEBUG) &&
+                              (!sPlayerbotAIConfig->logInGroupOnly || (bot->GetGroup() && botAI->HasRealPlayerMaster())));
+
+    if (logActions)
+        LogAction("--- AI Tick ---");
 
     if (sPlayerbotAIConfig->logValuesPerTick)
         LogValues();
@@ -152,6 +160,14 @@ bool Engine::DoNextAction(Unit* unit, uint32 depth, bool minimal)
     ProcessTriggers(minimal);
     PushDefaultActions();
 
+    activeMultipliers.clear();
+    multiplierFactors.clear();
+    for (Multiplier* multiplier : multipliers)
+    {
+        if (multiplier->IsActive())
+            activeMultipliers.push_back(multiplier);
+    }
+
     uint32 iterations = 0;
     uint32 iterationsPerTick = queue.Size() * (minimal ? 2 : sPlayerbotAIConfig->iterationsPerTick);
     
@@ -173,28 +189,43 @@ bool Engine::DoNextAction(Unit* unit, uint32 depth, bool minimal)
 
         if (!action)
         {
-            LogAction("A:%s - UNKNOWN", actionNode->getName().c_str());
+            if (logActions)
+                LogAction("A:%s - UNKNOWN", actionNode->getName().c_str());
         }
         else if (action->isUseful())
         {
-            // Apply multipliers early to avoid unnecessary iterations
-            for (Multiplier* multiplier : multipliers)
+            // Apply multipliers early to avoid unnecessary iterations, each action is scored once per tick
+            if (!multipliers.empty())
             {
-                relevance *= multiplier->GetValue(action);
-                action->setRelevance(relevance);
-
-                if (relevance <= 0)
+                auto factor = multiplierFactors.find(action);
+                if (factor == multiplierFactors.end())
                 {
-                    LogAction("Multiplier %s made action %s useless", multiplier->getName().c_str(), action->getName().c_str());
-                    break;
+                    float value = 1.0f;
+                    for (Multiplier* multiplier : activeMultipliers)
+                    {
+                        value *= multiplier->GetValue(action);
+                        if (value <= 0)
+                        {
+                            if (logActions)
+                                LogAction("Multiplier %s made action %s useless", multiplier->getName().c_str(), action->getName().c_str());
+                            break;
+                        }
+                    }
+
+                    factor = multiplierFactors.emplace(action, value).first;
                 }
+
+                relevance *= factor->second;
+                action->setRelevance(relevance);
             }
 
             if (action->isPossible() && relevance > 0)
             {
                 if (!skipPrerequisites)
                 {
-                    LogAction("A:%s - PREREQ", action->getName().c_str());
+                    if (logActions)
+                        LogAction("A:%s - PREREQ", action->getName().c_str());
+                    trace.Record(action, event.GetSource(), relevance, DECISION_PREREQ);
 
                     if (MultiplyAndPush(actionNode->getPrerequisites(), relevance + 0.002f, false, event, "prereq"))
                     {
@@ -210,7 +241,9 @@ bool Engine::DoNextAction(Unit* unit, uint32 depth, bool minimal)
 
                 if (actionExecuted)
                 {
-                    LogAction("A:%s - OK", action->getName().c_str());
+                    if (logActions)
+                        LogAction("A:%s - OK", action->getName().c_str());
+                    trace.Record(action, event.GetSource(), relevance, DECISION_OK);
                     MultiplyAndPush(actionNode->getContinuers(), relevance, false, event, "cont");
                     lastRelevance = relevance;
                     delete actionNode;  // Safe memory management
@@ -218,19 +251,25 @@ bool Engine::DoNextAction(Unit* unit, uint32 depth, bool minimal)
                 }
                 else
                 {
-                    LogAction("A:%s - FAILED", action->getName().c_str());
+                    if (logActions)
+                        LogAction("A:%s - FAILED", action->getName().c_str());
+                    trace.Record(action, event.GetSource(), relevance, DECISION_FAILED);
                     MultiplyAndPush(actionNode->getAlternatives(), relevance + 0.003f, false, event, "alt");
                 }
             }
             else
             {
-                LogAction("A:%s - IMPOSSIBLE", action->getName().c_str());
+                if (logActions)
+                    LogAction("A:%s - IMPOSSIBLE", action->getName().c_str());
+                trace.Record(action, event.GetSource(), relevance, DECISION_IMPOSSIBLE);
                 MultiplyAndPush(actionNode->getAlternatives(), relevance + 0.003f, false, event, "alt");
             }
         }
         else
         {
-            LogAction("A:%s - USELESS", action->getName().c_str());
+            if (logActions)
+                LogAction("A:%s - USELESS", action->getName().c_str());
+            trace.Record(action, event.GetSource(), relevance, DECISION_USELESS);
             lastRelevance = relevance;
         }
 
@@ -284,7 +323,8 @@ bool Engine::MultiplyAndPush(NextAction** actions, float forceRelevance, bool sk
 
                 if (k > 0)
                 {
-                    LogAction("PUSH:%s - %f (%s)", action->getName().c_str(), k, pushType);
+                    if (logActions)
+                        LogAction("PUSH:%s - %f (%s)", action->getName().c_str(), k, pushType);
                     queue.Push(new ActionBasket(action, k, skipPrerequisites, event));
                     pushed = true;
                 }
@@ -469,7 +509,8 @@ void Engine::ProcessTriggers(bool minimal)
                 continue;
 
             fires[trigger] = event;
-            LogAction("T:%s", trigger->getName().c_str());
+            if (logActions)
+                LogAction("T:%s", trigger->getName().c_str());
         }
     }
 
@@ -568,7 +609,7 @@ bool Engine::ListenAndExecute(Action* action, Event event)
         actionExecuted = actionExecutionListeners.AllowExecution(action, event) ? action->Execute(event) : true;
     }
 
-    if (botAI->HasStrategy("debug", BOT_STATE_NON_COMBAT))
+    if (botAI->HasDebugStrategy())
     {
         std::ostringstream out;
         out << "do: ";
@@ -594,6 +635,9 @@ bool Engine::ListenAndExecute(Action* action, Event event)
 
 void Engine::LogAction(char const* format, ...)
 {
+    if (!testMode && !sLog->ShouldLog("playerbots", LOG_LEVEL_DEBUG))
+        return;
+
     Player* bot = botAI->GetBot();
     if (sPlayerbotAIConfig->logInGroupOnly && (!bot->GetGroup() || !botAI->HasRealPlayerMaster()) && !testMode)
         return;
@@ -602,18 +646,9 @@ void Engine::LogAction(char const* format, ...)
 
     va_list ap;
     va_start(ap, format);
-    vsprintf(buf, format, ap);
+    vsnprintf(buf, sizeof(buf), format, ap);
     va_end(ap);
 
-    lastAction += "|";
-    lastAction += buf;
-    if (lastAction.size() > 512)
-    {
-        lastAction = lastAction.substr(512);
-        size_t pos = lastAction.find("|");
-        lastAction = (pos == std::string::npos ? "" : lastAction.substr(pos));
-    }
-
     if (testMode)
     {
         FILE* file = fopen("test.log", "a");
@@ -627,6 +662,12 @@ void Engine::LogAction(char const* format, ...)
     }
 }
 
+std::string const Engine::GetLastAction()
+{
+    std::vector<std::string> const last = trace.Decode(1);
+    return last.empty() ? "" : last.front();
+}
+
 void Engine::ChangeStrategy(std::string const names)
 {
     std::vector<std::string> splitted = split(names, ',');
@@ -7,7 +7,9 @@
 #define _PLAYERBOT_ENGINE_H
 
 #include <map>
+#include <unordered_map>
 
+#include "DecisionTrace.h"
 #include "Multiplier.h"
 #include "PlayerbotAIAware.h"
 #include "Queue.h"
@@ -76,7 +78,8 @@ public:
     std::vector<std::string> GetStrategies();
     bool ContainsStrategy(StrategyType type);
     void ChangeStrategy(std::string const names);
-    std::string const GetLastAction() { return lastAction; }
+    // Newest entry of the bot's decision trace
+    std::string const GetLastAction();
 
     virtual bool DoNextAction(Unit*, uint32 depth = 0, bool minimal = false);
     ActionResult ExecuteAction(std::string const name, Event event = Event(), std::string const qualifier = "");
@@ -85,6 +88,7 @@ public:
 
     void removeActionExecutionListener(ActionExecutionListener* listener) { actionExecutionListeners.Remove(listener); }
     bool HasStrategyType(StrategyType type) { return strategyTypeMask & type; }
+    bool HasDebugStrategy() const { return debugStrategy; }
     virtual ~Engine(void);
 
     bool testMode;
@@ -106,14 +110,20 @@ private:
     ActionExecutionListeners actionExecutionListeners;
 
 protected:
+    DecisionTrace& trace;
     Queue queue;
     std::vector<TriggerNode*> triggers;
     std::vector<Multiplier*> multipliers;
+    // Rebuilt every tick: the multipliers whose IsActive() holds and the factor they give each scored action
+    std::vector<Multiplier*> activeMultipliers;
+    std::unordered_map<Action*, float> multiplierFactors;
     AiObjectContext* aiObjectContext;
     std::map<std::string, Strategy*> strategies;
     float lastRelevance;
-    std::string lastAction;
     uint32 strategyTypeMask;
+    bool debugStrategy = false;
+    // Whether this tick formats its decisions for the debug log, the decision trace is always recorded
+    bool logActions = false;
 };
 
 #endif
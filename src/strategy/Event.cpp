@@ -5,19 +5,72 @@
 
 #include "Event.h"
 
+#include <shared_mutex>
+#include <unordered_set>
+
 #include "Playerbots.h"
 
-Event::Event(std::string const source, ObjectGuid object, Player* owner) : source(source), owner(owner)
+namespace
+{
+// Sources are trigger and action names, so the set stays small and its entries live as long as the server
+std::string const* InternSource(std::string const& source)
 {
-    packet << object;
+    static std::unordered_set<std::string> sources;
+    static std::shared_mutex lock;
+
+    {
+        std::shared_lock<std::shared_mutex> guard(lock);
+        auto itr = sources.find(source);
+        if (itr != sources.end())
+            return &*itr;
+    }
+
+    std::unique_lock<std::shared_mutex> guard(lock);
+    return &*sources.insert(source).first;
 }
 
-ObjectGuid Event::getObject()
+std::string const emptyString;
+WorldPacket const emptyPacket;
+}  // namespace
+
+Event::Event(std::string const source) : source(InternSource(source)) {}
+
+Event::Event(std::string const source, std::string const param, Player* owner)
+    : source(InternSource(source)), owner(owner)
+{
+    if (!param.empty())
+        this->param = std::make_shared<std::string const>(param);
+}
+
+Event::Event(std::string const source, WorldPacket& packet, Player* owner)
+    : source(InternSource(source)), packet(std::make_shared<WorldPacket const>(packet)), owner(owner)
+{
+}
+
+Event::Event(std::string const source, std::shared_ptr<WorldPacket const> packet, Player* owner)
+    : source(InternSource(source)), packet(std::move(packet)), owner(owner)
+{
+}
+
+Event::Event(std::string const source, ObjectGuid object, Player* owner) : source(InternSource(source)), owner(owner)
+{
+    std::shared_ptr<WorldPacket> data = std::make_shared<WorldPacket>();
+    *data << object;
+    packet = std::move(data);
+}
+
+std::string const& Event::GetSource() const { return source ? *source : emptyString; }
+
+std::string const& Event::getParam() const { return param ? *param : emptyString; }
+
+WorldPacket const& Event::getPacket() const { return packet ? *packet : emptyPacket; }
+
+ObjectGuid Event::getObject() const
 {
-    if (packet.empty())
+    if (!packet || packet->empty())
         return ObjectGuid::Empty;
 
-    WorldPacket p(packet);
+    WorldPacket p(*packet);
     p.rpos(0);
 
     ObjectGuid guid;
@@ -6,39 +6,37 @@
 #ifndef _PLAYERBOT_EVENT_H
 #define _PLAYERBOT_EVENT_H
 
+#include <memory>
+
 #include "WorldPacket.h"
 
 class ObjectGuid;
 class Player;
 
+// Cheap to copy: the source is an interned name, param and packet are shared and never modified after the event
+// is created. Actions that read the packet copy it first, as reading moves its read position.
 class Event
 {
 public:
-    Event(Event const& other) : source(other.source), param(other.param), packet(other.packet), owner(other.owner) {}
     Event() {}
-    Event(std::string const source) : source(source) {}
-    Event(std::string const source, std::string const param, Player* owner = nullptr)
-        : source(source), param(param), owner(owner)
-    {
-    }
-    Event(std::string const source, WorldPacket& packet, Player* owner = nullptr)
-        : source(source), packet(packet), owner(owner)
-    {
-    }
+    Event(std::string const source);
+    Event(std::string const source, std::string const param, Player* owner = nullptr);
+    Event(std::string const source, WorldPacket& packet, Player* owner = nullptr);
+    Event(std::string const source, std::shared_ptr<WorldPacket const> packet, Player* owner = nullptr);
     Event(std::string const source, ObjectGuid object, Player* owner = nullptr);
     virtual ~Event() {}
 
-    std::string const GetSource() { return source; }
-    std::string const getParam() { return param; }
-    WorldPacket& getPacket() { return packet; }
-    ObjectGuid getObject();
-    Player* getOwner() { return owner; }
-    bool operator!() const { return source.empty(); }
+    std::string const& GetSource() const;
+    std::string const& getParam() const;
+    WorldPacket const& getPacket() const;
+    ObjectGuid getObject() const;
+    Player* getOwner() const { return owner; }
+    bool operator!() const { return !source || source->empty(); }
 
 protected:
-    std::string source;
-    std::string param;
-    WorldPacket packet;
+    std::string const* source = nullptr;
+    std::shared_ptr<std::string const> param;
+    std::shared_ptr<WorldPacket const> packet;
     Player* owner = nullptr;
 };
 
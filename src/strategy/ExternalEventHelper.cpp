@@ -39,20 +39,18 @@ bool ExternalEventHelper::ParseChatCommand(std::string const command, Player* ow
     return true;
 }
 
-void ExternalEventHelper::HandlePacket(std::map<uint16, std::string>& handlers, WorldPacket const& packet,
-                                       Player* owner)
+void ExternalEventHelper::HandlePacket(std::map<uint16, std::string> const& handlers,
+                                       std::shared_ptr<WorldPacket const> const& packet, Player* owner)
 {
-    uint16 opcode = packet.GetOpcode();
-    std::string const name = handlers[opcode];
-    if (name.empty())
+    auto i = handlers.find(packet->GetOpcode());
+    if (i == handlers.end() || i->second.empty())
         return;
 
-    Trigger* trigger = aiObjectContext->GetTrigger(name);
+    Trigger* trigger = aiObjectContext->GetTrigger(i->second);
     if (!trigger)
         return;
 
-    WorldPacket p(packet);
-    trigger->ExternalEvent(p, owner);
+    trigger->ExternalEvent(packet, owner);
 }
 
 bool ExternalEventHelper::HandleCommand(std::string const name, std::string const param, Player* owner)
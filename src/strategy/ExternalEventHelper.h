@@ -7,6 +7,7 @@
 #define _PLAYERBOT_EXTERNALEVENTHELPER_H
 
 #include <map>
+#include <memory>
 
 #include "Common.h"
 
@@ -20,7 +21,8 @@ public:
     ExternalEventHelper(AiObjectContext* aiObjectContext) : aiObjectContext(aiObjectContext) {}
 
     bool ParseChatCommand(std::string const command, Player* owner = nullptr);
-    void HandlePacket(std::map<uint16, std::string>& handlers, WorldPacket const& packet, Player* owner = nullptr);
+    void HandlePacket(std::map<uint16, std::string> const& handlers, std::shared_ptr<WorldPacket const> const& packet,
+                      Player* owner = nullptr);
     bool HandleCommand(std::string const name, std::string const param, Player* owner = nullptr);
 
 private:
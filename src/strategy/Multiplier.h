@@ -18,6 +18,9 @@ public:
     virtual ~Multiplier() {}
 
     virtual float GetValue([[maybe_unused]] Action* action) { return 1.0f; }
+    // Checked once per engine tick before any action is scored. Multipliers guarded by an encounter or aura
+    // should return false while it does not apply, so GetValue is not called for every candidate action.
+    virtual bool IsActive() { return true; }
 };
 
 #endif
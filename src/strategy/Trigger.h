@@ -21,7 +21,10 @@ public:
 
     virtual Event Check();
     virtual void ExternalEvent([[maybe_unused]] std::string const param, [[maybe_unused]] Player* owner = nullptr) {}
-    virtual void ExternalEvent([[maybe_unused]] WorldPacket& packet, [[maybe_unused]] Player* owner = nullptr) {}
+    virtual void ExternalEvent([[maybe_unused]] std::shared_ptr<WorldPacket const> const& packet,
+                               [[maybe_unused]] Player* owner = nullptr)
+    {
+    }
     virtual bool IsActive() { return false; }
     virtual NextAction** getHandlers() { return nullptr; }
     void Update() {}
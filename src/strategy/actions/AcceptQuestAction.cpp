@@ -69,7 +69,7 @@ bool AcceptQuestAction::Execute(Event event)
     }
     else
     {
-        WorldPacket& p = event.getPacket();
+        WorldPacket p(event.getPacket());
         p.rpos(0);
         p >> guid >> quest;
     }
@@ -99,7 +99,7 @@ bool AcceptQuestShareAction::Execute(Event event)
     Player* master = GetMaster();
     Player* bot = botAI->GetBot();
 
-    WorldPacket& p = event.getPacket();
+    WorldPacket p(event.getPacket());
     p.rpos(0);
     uint32 quest;
     p >> quest;
@@ -161,7 +161,7 @@ bool ConfirmQuestAction::Execute(Event event)
     Player* bot = botAI->GetBot();
     Player* requester = event.getOwner() ? event.getOwner() : GetMaster();
 
-    WorldPacket& p = event.getPacket();
+    WorldPacket p(event.getPacket());
     p.rpos(0);
     uint32 quest;
     p >> quest;
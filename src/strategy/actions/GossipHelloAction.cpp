@@ -13,7 +13,7 @@ bool GossipHelloAction::Execute(Event event)
 {
     ObjectGuid guid;
 
-    WorldPacket& p = event.getPacket();
+    WorldPacket p(event.getPacket());
     if (p.empty())
     {
         Player* master = GetMaster();
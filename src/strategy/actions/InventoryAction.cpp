@@ -22,6 +22,34 @@ void InventoryAction::IterateItems(IterateItemsVisitor* visitor, IterateItemsMas
         IterateItemsInBank(visitor);
 }
 
+void InventoryAction::IterateIndexedItems(std::vector<Item*> const& items, IterateItemsVisitor* visitor,
+                                          IterateItemsMask mask)
+{
+    // the bank is not indexed
+    if (mask == ITERATE_ITEMS_IN_BANK)
+    {
+        IterateItems(visitor, mask);
+        return;
+    }
+
+    InventoryIndex& index = botAI->GetInventoryIndex();
+    index.BeginIteration();
+    for (Item* item : items)
+    {
+        if (!(mask & (item->IsEquipped() ? ITERATE_ITEMS_IN_EQUIP : ITERATE_ITEMS_IN_BAGS)))
+            continue;
+
+        if (!visitor->Visit(item))
+            break;
+    }
+    index.EndIteration();
+}
+
+void InventoryAction::IterateIndexedItems(IterateItemsVisitor* visitor, IterateItemsMask mask)
+{
+    IterateIndexedItems(botAI->GetInventoryIndex().GetItems(), visitor, mask);
+}
+
 void InventoryAction::IterateItemsInBags(IterateItemsVisitor* visitor)
 {
     for (uint32 i = INVENTORY_SLOT_ITEM_START; i < INVENTORY_SLOT_ITEM_END; ++i)
@@ -199,7 +227,7 @@ std::vector<Item*> InventoryAction::parseItems(std::string const text, IterateIt
         for (ItemIds::iterator i = ids.begin(); i != ids.end(); i++)
         {
             FindItemByIdVisitor visitor(*i);
-            IterateItems(&visitor, mask);
+            IterateIndexedItems(botAI->GetInventoryIndex().GetItems(*i), &visitor, mask);
             found.insert(visitor.GetResult().begin(), visitor.GetResult().end());
         }
 
@@ -215,20 +243,20 @@ std::vector<Item*> InventoryAction::parseItems(std::string const text, IterateIt
     if (text == "food" || text == "conjured food")
     {
         FindFoodVisitor visitor(bot, 11, text == "conjured food");
-        IterateItems(&visitor, ITERATE_ITEMS_IN_BAGS);
+        IterateIndexedItems(&visitor, ITERATE_ITEMS_IN_BAGS);
         found.insert(visitor.GetResult().begin(), visitor.GetResult().end());
     }
 
     if (text == "drink" || text == "water" || text == "conjured drink" || text == "conjured water")
     {
         FindFoodVisitor visitor(bot, 59, text == "conjured drink" || text == "conjured water");
-        IterateItems(&visitor, ITERATE_ITEMS_IN_BAGS);
+        IterateIndexedItems(&visitor, ITERATE_ITEMS_IN_BAGS);
         found.insert(visitor.GetResult().begin(), visitor.GetResult().end());
 
         if (found.empty())
         {
             FindFoodVisitor visitor(bot, 11);
-            IterateItems(&visitor, ITERATE_ITEMS_IN_BAGS);
+            IterateIndexedItems(&visitor, ITERATE_ITEMS_IN_BAGS);
             found.insert(visitor.GetResult().begin(), visitor.GetResult().end());
         }
     }
@@ -236,28 +264,28 @@ std::vector<Item*> InventoryAction::parseItems(std::string const text, IterateIt
     if (text == "mana potion")
     {
         FindPotionVisitor visitor(bot, SPELL_EFFECT_ENERGIZE);
-        IterateItems(&visitor, ITERATE_ITEMS_IN_BAGS);
+        IterateIndexedItems(&visitor, ITERATE_ITEMS_IN_BAGS);
         found.insert(visitor.GetResult().begin(), visitor.GetResult().end());
     }
 
     if (text == "healing potion")
     {
         FindPotionVisitor visitor(bot, SPELL_EFFECT_HEAL);
-        IterateItems(&visitor, ITERATE_ITEMS_IN_BAGS);
+        IterateIndexedItems(&visitor, ITERATE_ITEMS_IN_BAGS);
         found.insert(visitor.GetResult().begin(), visitor.GetResult().end());
     }
 
     if (text == "mount")
     {
         FindMountVisitor visitor(bot);
-        IterateItems(&visitor, ITERATE_ITEMS_IN_BAGS);
+        IterateIndexedItems(&visitor, ITERATE_ITEMS_IN_BAGS);
         found.insert(visitor.GetResult().begin(), visitor.GetResult().end());
     }
 
     if (text == "pet")
     {
         FindPetVisitor visitor(bot);
-        IterateItems(&visitor, ITERATE_ITEMS_IN_BAGS);
+        IterateIndexedItems(&visitor, ITERATE_ITEMS_IN_BAGS);
         found.insert(visitor.GetResult().begin(), visitor.GetResult().end());
     }
 
@@ -266,7 +294,7 @@ std::vector<Item*> InventoryAction::parseItems(std::string const text, IterateIt
         if (Item* const pItem = bot->GetItemByPos(INVENTORY_SLOT_BAG_0, EQUIPMENT_SLOT_RANGED))
         {
             FindAmmoVisitor visitor(bot, pItem->GetTemplate()->SubClass);
-            IterateItems(&visitor, ITERATE_ITEMS_IN_BAGS);
+            IterateIndexedItems(&visitor, ITERATE_ITEMS_IN_BAGS);
             found.insert(visitor.GetResult().begin(), visitor.GetResult().end());
         }
     }
@@ -274,33 +302,33 @@ std::vector<Item*> InventoryAction::parseItems(std::string const text, IterateIt
     if (text == "recipe")
     {
         FindRecipeVisitor visitor(bot);
-        IterateItems(&visitor, ITERATE_ITEMS_IN_BAGS);
+        IterateIndexedItems(&visitor, ITERATE_ITEMS_IN_BAGS);
         found.insert(visitor.GetResult().begin(), visitor.GetResult().end());
     }
 
     if (text == "quest")
     {
         FindQuestItemVisitor visitor(bot);
-        IterateItems(&visitor, ITERATE_ITEMS_IN_BAGS);
+        IterateIndexedItems(&visitor, ITERATE_ITEMS_IN_BAGS);
         found.insert(visitor.GetResult().begin(), visitor.GetResult().end());
     }
 
     if (text.find("usage ") != std::string::npos)
     {
         FindItemUsageVisitor visitor(bot, ItemUsage(stoi(text.substr(6))));
-        IterateItems(&visitor, ITERATE_ITEMS_IN_BAGS);
+        IterateIndexedItems(&visitor, ITERATE_ITEMS_IN_BAGS);
         found.insert(visitor.GetResult().begin(), visitor.GetResult().end());
     }
 
     FindNamedItemVisitor visitor(bot, text);
-    IterateItems(&visitor, ITERATE_ITEMS_IN_BAGS);
+    IterateIndexedItems(&visitor, ITERATE_ITEMS_IN_BAGS);
     found.insert(visitor.GetResult().begin(), visitor.GetResult().end());
 
     uint32 quality = chat->parseItemQuality(text);
     if (quality != MAX_ITEM_QUALITY)
     {
         FindItemsToTradeByQualityVisitor visitor(quality, count);
-        IterateItems(&visitor, mask);
+        IterateIndexedItems(&visitor, mask);
         found.insert(visitor.GetResult().begin(), visitor.GetResult().end());
     }
 
@@ -308,7 +336,8 @@ std::vector<Item*> InventoryAction::parseItems(std::string const text, IterateIt
     if (chat->parseItemClass(text, &itemClass, &itemSubClass))
     {
         FindItemsToTradeByClassVisitor visitor(itemClass, itemSubClass, count);
-        IterateItems(&visitor, mask);
+        IterateIndexedItems(botAI->GetInventoryIndex().GetItemsByClass(itemClass, itemSubClass), &visitor,
+                                mask);
         found.insert(visitor.GetResult().begin(), visitor.GetResult().end());
     }
 
@@ -323,7 +352,7 @@ std::vector<Item*> InventoryAction::parseItems(std::string const text, IterateIt
     if (!outfit.empty())
     {
         FindItemByIdsVisitor visitor(outfit);
-        IterateItems(&visitor, mask);
+        IterateIndexedItems(&visitor, mask);
         found.insert(visitor.GetResult().begin(), visitor.GetResult().end());
     }
 
@@ -331,7 +360,7 @@ std::vector<Item*> InventoryAction::parseItems(std::string const text, IterateIt
     for (ItemIds::iterator i = ids.begin(); i != ids.end(); i++)
     {
         FindItemByIdVisitor visitor(*i);
-        IterateItems(&visitor, mask);
+        IterateIndexedItems(botAI->GetInventoryIndex().GetItems(*i), &visitor, mask);
         found.insert(visitor.GetResult().begin(), visitor.GetResult().end());
     }
 
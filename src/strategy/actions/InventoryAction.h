@@ -29,6 +29,9 @@ protected:
     ItemIds FindOutfitItems(std::string const name);
 
 private:
+    // read-only lookups over the bot's inventory index, visitors must not move or destroy items
+    void IterateIndexedItems(std::vector<Item*> const& items, IterateItemsVisitor* visitor, IterateItemsMask mask);
+    void IterateIndexedItems(IterateItemsVisitor* visitor, IterateItemsMask mask);
     void IterateItemsInBags(IterateItemsVisitor* visitor);
     void IterateItemsInEquip(IterateItemsVisitor* visitor);
     void IterateItemsInBank(IterateItemsVisitor* visitor);
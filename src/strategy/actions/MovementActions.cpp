@@ -23,6 +23,7 @@
 #include "MovementGenerator.h"
 #include "ObjectDefines.h"
 #include "ObjectGuid.h"
+#include "PathCache.h"
 #include "PathGenerator.h"
 #include "PlayerbotAI.h"
 #include "PlayerbotAIConfig.h"
@@ -137,9 +138,9 @@ bool MovementAction::MoveToLOS(WorldObject* target, bool ranged)
     float z = target->GetPositionZ();
 
     // Use standard PathGenerator to find a route.
-    PathGenerator path(bot);
-    path.CalculatePath(x, y, z, false);
-    PathType type = path.GetPathType();
+    CachedPath path;
+    sPathCache->CalculatePath(bot, x, y, z, false, path);
+    PathType type = path.type;
     if (type != PATHFIND_NORMAL && type != PATHFIND_INCOMPLETE)
         return false;
 
@@ -149,9 +150,9 @@ bool MovementAction::MoveToLOS(WorldObject* target, bool ranged)
     float dist = FLT_MAX;
     PositionInfo dest;
 
-    if (!path.GetPath().empty())
+    if (!path.points.empty())
     {
-        for (auto& point : path.GetPath())
+        for (auto& point : path.points)
         {
             if (botAI->HasStrategy("debug move", BOT_STATE_NON_COMBAT))
                 CreateWp(bot, point.x, point.y, point.z, 0.0, 2334);
@@ -1707,18 +1708,18 @@ const Movement::PointsArray MovementAction::SearchForBestPath(float x, float y,
     bool found = false;
     modified_z = INVALID_HEIGHT;
     float tempZ = bot->GetMapHeight(x, y, z);
-    PathGenerator gen(bot);
-    gen.CalculatePath(x, y, tempZ);
-    Movement::PointsArray result = gen.GetPath();
-    float min_length = gen.getPathLength();
+    CachedPath gen;
+    sPathCache->CalculatePath(bot, x, y, tempZ, false, gen);
+    Movement::PointsArray result = gen.points;
+    float min_length = gen.length;
     int typeOk = PATHFIND_NORMAL | PATHFIND_INCOMPLETE;
-    if ((gen.GetPathType() & typeOk) && abs(tempZ - z) < 0.5f)
+    if ((gen.type & typeOk) && abs(tempZ - z) < 0.5f)
     {
         modified_z = tempZ;
         return result;
     }
     // Start searching
-    if (gen.GetPathType() & typeOk)
+    if (gen.type & typeOk)
     {
         modified_z = tempZ;
         found = true;
@@ -1731,13 +1732,12 @@ const Movement::PointsArray MovementAction::SearchForBestPath(float x, float y,
         {
             continue;
         }
-        PathGenerator gen(bot);
-        gen.CalculatePath(x, y, tempZ);
-        if ((gen.GetPathType() & typeOk) && gen.getPathLength() < min_length)
+        sPathCache->CalculatePath(bot, x, y, tempZ, false, gen);
+        if ((gen.type & typeOk) && gen.length < min_length)
         {
             found = true;
-            min_length = gen.getPathLength();
-            result = gen.GetPath();
+            min_length = gen.length;
+            result = gen.points;
             modified_z = tempZ;
         }
     }
@@ -1748,13 +1748,12 @@ const Movement::PointsArray MovementAction::SearchForBestPath(float x, float y,
         {
             continue;
         }
-        PathGenerator gen(bot);
-        gen.CalculatePath(x, y, tempZ);
-        if ((gen.GetPathType() & typeOk) && gen.getPathLength() < min_length)
+        sPathCache->CalculatePath(bot, x, y, tempZ, false, gen);
+        if ((gen.type & typeOk) && gen.length < min_length)
         {
             found = true;
-            min_length = gen.getPathLength();
-            result = gen.GetPath();
+            min_length = gen.length;
+            result = gen.points;
             modified_z = tempZ;
         }
     }
@@ -2042,10 +2041,10 @@ Position MovementAction::BestPositionForMeleeToFlee(Position pos, float radius)
     }
     float farestDis = 0.0f;
     Position bestPos;
+    std::list<FleeInfo>& infoList = AI_VALUE(std::list<FleeInfo>&, "recently flee info");
     for (CheckAngle& checkAngle : possibleAngles)
     {
         float angle = checkAngle.angle;
-        std::list<FleeInfo>& infoList = AI_VALUE(std::list<FleeInfo>&, "recently flee info");
         if (!CheckLastFlee(angle, infoList))
         {
             continue;
@@ -2105,10 +2104,10 @@ Position MovementAction::BestPositionForRangedToFlee(Position pos, float radius)
     }
     float farestDis = 0.0f;
     Position bestPos;
+    std::list<FleeInfo>& infoList = AI_VALUE(std::list<FleeInfo>&, "recently flee info");
     for (CheckAngle& checkAngle : possibleAngles)
     {
         float angle = checkAngle.angle;
-        std::list<FleeInfo>& infoList = AI_VALUE(std::list<FleeInfo>&, "recently flee info");
         if (!CheckLastFlee(angle, infoList))
         {
             continue;
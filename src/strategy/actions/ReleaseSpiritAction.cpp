@@ -30,7 +30,7 @@ bool ReleaseSpiritAction::Execute(Event event)
         return false;
     }
 
-    const WorldPacket& packet = event.getPacket();
+    WorldPacket const& packet = event.getPacket();
     const std::string message = !packet.empty() && packet.GetOpcode() == CMSG_REPOP_REQUEST 
                                 ? "Releasing..." 
                                 : "Meet me at the graveyard";
@@ -21,7 +21,7 @@ bool ReviveFromCorpseAction::Execute(Event event)
     Corpse* corpse = bot->GetCorpse();
 
     // follow master when master revives
-    WorldPacket& p = event.getPacket();
+    WorldPacket const& p = event.getPacket();
     if (!p.empty() && p.GetOpcode() == CMSG_RECLAIM_CORPSE && master && !corpse && bot->IsAlive())
     {
         if (sServerFacade->IsDistanceLessThan(AI_VALUE2(float, "distance", "master target"),
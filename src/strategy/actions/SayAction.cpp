@@ -6,7 +6,6 @@
 #include "AiFactory.h"
 #include "SayAction.h"
 
-#include <regex>
 #include <string>
 
 #include "ChannelMgr.h"
@@ -15,45 +14,6 @@
 #include "PlayerbotTextMgr.h"
 #include "Playerbots.h"
 
-static const std::unordered_set<std::string> noReplyMsgs = {
-    "join",
-    "leave",
-    "follow",
-    "attack",
-    "pull",
-    "flee",
-    "reset",
-    "reset ai",
-    "all ?",
-    "talents",
-    "talents list",
-    "talents auto",
-    "talk",
-    "stay",
-    "stats",
-    "who",
-    "items",
-    "leave",
-    "join",
-    "repair",
-    "summon",
-    "nc ?",
-    "co ?",
-    "de ?",
-    "dead ?",
-    "follow",
-    "los",
-    "guard",
-    "do accept invitation",
-    "stats",
-    "react ?",
-    "reset strats",
-    "home",
-};
-static const std::unordered_set<std::string> noReplyMsgParts = {
-    "+", "-", "@", "follow target", "focus heal", "cast ", "accept [", "e [", "destroy [", "go zone"};
-static const std::unordered_set<std::string> noReplyMsgStarts = {"e ", "accept ", "cast ", "destroy "};
-
 SayAction::SayAction(PlayerbotAI* botAI) : Action(botAI, "say"), Qualified() {}
 
 bool SayAction::Execute(Event event)
@@ -157,44 +117,18 @@ bool SayAction::isUseful()
     return (time(nullptr) - lastSaid) > 30;
 }
 
-void ChatReplyAction::ChatReplyDo(Player* bot, uint32& type, uint32& guid1, uint32& guid2, std::string& msg, std::string& chanName, std::string& name)
+void ChatReplyAction::ChatReplyDo(Player* bot, ParsedChatMessage const& parsed)
 {
-    ChatReplyType replyType = REPLY_NOT_UNDERSTAND;  // default not understand
-    std::string respondsText = "";
-
-    // if we're just commanding bots around, don't respond...
-    // first one is for exact word matches
-    if (noReplyMsgs.find(msg) != noReplyMsgs.end())
-    {
-        /*std::ostringstream out;
-        out << "DEBUG ChatReplyDo decided to ignore exact blocklist match" << msg;
-        bot->Say(out.str(), LANG_UNIVERSAL);*/
-        return;
-    }
-
-    // second one is for partial matches like + or - where we change strats
-    if (std::any_of(noReplyMsgParts.begin(), noReplyMsgParts.end(),
-                    [&msg](const std::string& part) { return msg.find(part) != std::string::npos; }))
-    {
-        /*std::ostringstream out;
-        out << "DEBUG ChatReplyDo decided to ignore partial blocklist match" << msg;
-        bot->Say(out.str(), LANG_UNIVERSAL);*/
+    // bot commands are filtered when the message is parsed
+    if (parsed.noReply)
         return;
-    }
 
-    if (std::any_of(noReplyMsgStarts.begin(), noReplyMsgStarts.end(),
-                    [&msg](const std::string& start)
-                    {
-                        return msg.find(start) == 0;  // Check if the start matches the beginning of msg
-                    }))
-    {
-        /*std::ostringstream out;
-        out << "DEBUG ChatReplyDo decided to ignore start blocklist match" << msg;
-        bot->Say(out.str(), LANG_UNIVERSAL);*/
-        return;
-    }
+    std::string msg = parsed.message;
+    std::string name = parsed.senderName;
+    uint32 guid1 = parsed.sender.GetCounter();
 
-    ChatChannelSource chatChannelSource = GET_PLAYERBOT_AI(bot)->GetChatChannelSource(bot, type, chanName);
+    ChatChannelSource chatChannelSource =
+        GET_PLAYERBOT_AI(bot)->GetChatChannelSource(bot, parsed.type, parsed.channelName);
     if ( (msg.starts_with("LFG") || msg.starts_with("LFM")) && HandleLFGQuestsReply(bot, chatChannelSource, msg, name))
     {
         return;
@@ -206,15 +140,14 @@ void ChatReplyAction::ChatReplyDo(Player* bot, uint32& type, uint32& guid1, uint
     }
 
     //toxic links
-    if (msg.starts_with(sPlayerbotAIConfig->toxicLinksPrefix)
-        && (GET_PLAYERBOT_AI(bot)->GetChatHelper()->ExtractAllItemIds(msg).size() > 0 || GET_PLAYERBOT_AI(bot)->GetChatHelper()->ExtractAllQuestIds(msg).size() > 0))
+    if (parsed.toxicLinks)
     {
         HandleToxicLinksReply(bot, chatChannelSource, msg, name);
         return;
     }
 
     //thunderfury
-    if (GET_PLAYERBOT_AI(bot)->GetChatHelper()->ExtractAllItemIds(msg).count(19019))
+    if (parsed.thunderfury)
     {
         HandleThunderfuryReply(bot, chatChannelSource, msg, name);
         return;
@@ -667,7 +600,7 @@ std::string ChatReplyAction::GenerateReplyMessage(Player* bot, std::string& inco
                     if (rnd == 2)
                         msg = "fine, i wont talk to you anymore %s";
 
-                    msg = std::regex_replace(msg, std::regex("%s"), name);
+                    PlayerbotTextMgr::replaceAll(msg, "%s", name);
                     respondsText = msg;
                     found = true;
                     break;
@@ -706,7 +639,7 @@ std::string ChatReplyAction::GenerateReplyMessage(Player* bot, std::string& inco
                 break;
             }
 
-            msg = std::regex_replace(msg, std::regex("%s"), name);
+            PlayerbotTextMgr::replaceAll(msg, "%s", name);
             respondsText = msg;
             found = true;
             break;
@@ -735,7 +668,7 @@ std::string ChatReplyAction::GenerateReplyMessage(Player* bot, std::string& inco
                 break;
             }
 
-            msg = std::regex_replace(msg, std::regex("%s"), name);
+            PlayerbotTextMgr::replaceAll(msg, "%s", name);
             respondsText = msg;
             found = true;
             break;
@@ -770,7 +703,7 @@ std::string ChatReplyAction::GenerateReplyMessage(Player* bot, std::string& inco
                 break;
             }
 
-            msg = std::regex_replace(msg, std::regex("%s"), name);
+            PlayerbotTextMgr::replaceAll(msg, "%s", name);
             respondsText = msg;
             found = true;
             break;
@@ -805,7 +738,7 @@ std::string ChatReplyAction::GenerateReplyMessage(Player* bot, std::string& inco
                 break;
             }
 
-            msg = std::regex_replace(msg, std::regex("%s"), name);
+            PlayerbotTextMgr::replaceAll(msg, "%s", name);
             respondsText = msg;
             found = true;
             break;
@@ -839,7 +772,7 @@ std::string ChatReplyAction::GenerateReplyMessage(Player* bot, std::string& inco
                 msg = "dunno %s";
                 break;
             }
-            msg = std::regex_replace(msg, std::regex("%s"), name);
+            PlayerbotTextMgr::replaceAll(msg, "%s", name);
             respondsText = msg;
             found = true;
             break;
@@ -868,7 +801,7 @@ std::string ChatReplyAction::GenerateReplyMessage(Player* bot, std::string& inco
                     msg = "afraid that was before i was around or paying attention";
                     break;
                 }
-                msg = std::regex_replace(msg, std::regex("%s"), name);
+                PlayerbotTextMgr::replaceAll(msg, "%s", name);
                 respondsText = msg;
                 found = true;
                 break;
@@ -902,7 +835,7 @@ std::string ChatReplyAction::GenerateReplyMessage(Player* bot, std::string& inco
                     msg = "no";
                     break;
                 }
-                msg = std::regex_replace(msg, std::regex("%s"), name);
+                PlayerbotTextMgr::replaceAll(msg, "%s", name);
                 respondsText = msg;
                 found = true;
                 break;
@@ -942,7 +875,7 @@ std::string ChatReplyAction::GenerateReplyMessage(Player* bot, std::string& inco
                     msg = "maybe";
                     break;
                 }
-                msg = std::regex_replace(msg, std::regex("%s"), name);
+                PlayerbotTextMgr::replaceAll(msg, "%s", name);
                 respondsText = msg;
                 found = true;
                 break;
@@ -972,7 +905,7 @@ std::string ChatReplyAction::GenerateReplyMessage(Player* bot, std::string& inco
                 msg = word[verb_pos - 1] + " will " + word[verb_pos + 1] + " again though %s";
                 break;
             }
-            msg = std::regex_replace(msg, std::regex("%s"), name);
+            PlayerbotTextMgr::replaceAll(msg, "%s", name);
             respondsText = msg;
             found = true;
             break;
@@ -994,7 +927,7 @@ std::string ChatReplyAction::GenerateReplyMessage(Player* bot, std::string& inco
                 msg = "yeah i know " + word[verb_pos ? verb_pos - 1 : verb_pos + 1] + " is a " + word[verb_pos + 1];
                 break;
             }
-            msg = std::regex_replace(msg, std::regex("%s"), name);
+            PlayerbotTextMgr::replaceAll(msg, "%s", name);
             respondsText = msg;
             found = true;
             break;
@@ -1016,7 +949,7 @@ std::string ChatReplyAction::GenerateReplyMessage(Player* bot, std::string& inco
                 msg = "are you saying " + word[verb_pos - 1] + " will " + word[verb_pos + 1] + " " + word[verb_pos + 2] + " %s?";
                 break;
             }
-            msg = std::regex_replace(msg, std::regex("%s"), name);
+            PlayerbotTextMgr::replaceAll(msg, "%s", name);
             respondsText = msg;
             found = true;
             break;
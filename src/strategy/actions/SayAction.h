@@ -32,7 +32,7 @@ public:
     virtual bool Execute(Event event) { return true; }
     bool isUseful() { return true; }
 
-    static void ChatReplyDo(Player* bot, uint32& type, uint32& guid1, uint32& guid2, std::string& msg, std::string& chanName, std::string& name);
+    static void ChatReplyDo(Player* bot, ParsedChatMessage const& parsed);
     static bool HandleThunderfuryReply(Player* bot, ChatChannelSource chatChannelSource, std::string& msg, std::string& name);
     static bool HandleToxicLinksReply(Player* bot, ChatChannelSource chatChannelSource, std::string& msg, std::string& name);
     static bool HandleWTBItemsReply(Player* bot, ChatChannelSource chatChannelSource, std::string& msg, std::string& name);
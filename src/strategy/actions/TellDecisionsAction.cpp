@@ -0,0 +1,28 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#include "TellDecisionsAction.h"
+
+#include "Event.h"
+#include "Playerbots.h"
+
+bool TellDecisionsAction::Execute(Event event)
+{
+    std::string const param = event.getParam();
+    uint32 count = param.empty() ? 10 : std::min<uint32>(atoi(param.c_str()), DecisionTrace::SIZE);
+
+    std::vector<std::string> const lines = botAI->GetDecisionTrace().Decode(count);
+    if (lines.empty())
+    {
+        botAI->TellMaster("No decisions recorded");
+        return true;
+    }
+
+    // Oldest first so the chat reads top to bottom
+    for (auto i = lines.rbegin(); i != lines.rend(); ++i)
+        botAI->TellMasterNoFacing(*i);
+
+    return true;
+}
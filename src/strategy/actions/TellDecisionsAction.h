@@ -0,0 +1,21 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#ifndef _PLAYERBOT_TELLDECISIONSACTION_H
+#define _PLAYERBOT_TELLDECISIONSACTION_H
+
+#include "Action.h"
+
+class PlayerbotAI;
+
+class TellDecisionsAction : public Action
+{
+public:
+    TellDecisionsAction(PlayerbotAI* botAI) : Action(botAI, "decisions") {}
+
+    bool Execute(Event event) override;
+};
+
+#endif
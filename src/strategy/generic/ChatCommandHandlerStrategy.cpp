@@ -105,6 +105,7 @@ ChatCommandHandlerStrategy::ChatCommandHandlerStrategy(PlayerbotAI* botAI) : Pas
     supported.push_back("leave");
     supported.push_back("reputation");
     supported.push_back("log");
+    supported.push_back("decisions");
     supported.push_back("los");
     supported.push_back("rpg status");
     supported.push_back("aura");
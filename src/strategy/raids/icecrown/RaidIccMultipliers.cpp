@@ -32,14 +32,13 @@ std::mutex g_plagueMutex;  // Add mutex for thread safety
 }
 
 
-float IccLadyDeathwhisperMultiplier::GetValue(Action* action)
+bool IccLadyDeathwhisperMultiplier::IsActive()
 {
-    Unit* boss = AI_VALUE2(Unit*, "find target", "lady deathwhisper");
-    if (!boss)
-    {
-        return 1.0f;
-    }
+    return AI_VALUE2(Unit*, "find target", "lady deathwhisper") != nullptr;
+}
 
+float IccLadyDeathwhisperMultiplier::GetValue(Action* action)
+{
     if (dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<FollowAction*>(action))
     {
         return 0.0f;
@@ -48,14 +47,13 @@ float IccLadyDeathwhisperMultiplier::GetValue(Action* action)
     return 1.0f;
 }
 
-float IccAddsDbsMultiplier::GetValue(Action* action)
+bool IccAddsDbsMultiplier::IsActive()
 {
-    Unit* boss = AI_VALUE2(Unit*, "find target", "deathbringer saurfang");
-    if (!boss)
-    {
-        return 1.0f;
-    }
+    return AI_VALUE2(Unit*, "find target", "deathbringer saurfang") != nullptr;
+}
 
+float IccAddsDbsMultiplier::GetValue(Action* action)
+{
     if (dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<FollowAction*>(action))
     {
         return 0.0f;
@@ -104,15 +102,13 @@ float IccAddsDbsMultiplier::GetValue(Action* action)
     return 1.0f;
 }
 
-float IccDogsMultiplier::GetValue(Action* action)
+bool IccDogsMultiplier::IsActive()
 {
-    bool bossPresent = false;
-    if (AI_VALUE2(Unit*, "find target", "stinky") || AI_VALUE2(Unit*, "find target", "precious"))
-        bossPresent = true;
-
-    if (!bossPresent)
-        return 1.0f;
+    return AI_VALUE2(Unit*, "find target", "stinky") || AI_VALUE2(Unit*, "find target", "precious");
+}
 
+float IccDogsMultiplier::GetValue(Action* action)
+{
     if (botAI->IsMainTank(bot))
     {
         Aura* aura = botAI->GetAura("mortal wound", bot, false, true);
@@ -128,14 +124,13 @@ float IccDogsMultiplier::GetValue(Action* action)
     return 1.0f;
 }
 
-float IccFestergutMultiplier::GetValue(Action* action)
+bool IccFestergutMultiplier::IsActive()
 {
-    Unit* boss = AI_VALUE2(Unit*, "find target", "festergut");
-    if (!boss)
-    {
-        return 1.0f;
-    }
+    return AI_VALUE2(Unit*, "find target", "festergut") != nullptr;
+}
 
+float IccFestergutMultiplier::GetValue(Action* action)
+{
     if (dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<FollowAction*>(action))
     {
         return 0.0f;
@@ -166,15 +161,18 @@ float IccFestergutMultiplier::GetValue(Action* action)
     return 1.0f;
 }
 
+bool IccRotfaceMultiplier::IsActive()
+{
+    boss = AI_VALUE2(Unit*, "find target", "big ooze");
+    return boss != nullptr;
+}
+
 float IccRotfaceMultiplier::GetValue(Action* action)
 {
     // If we're already executing the escape movement, don't interrupt it
     if (dynamic_cast<IccRotfaceMoveAwayFromExplosionAction*>(action))
         return 1.0f;
 
-    Unit* boss = AI_VALUE2(Unit*, "find target", "big ooze");
-    if (!boss) { return 1.0f; }
-
     if (dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<FollowAction*>(action))
     {
         return 0.0f;
@@ -244,14 +242,13 @@ float IccRotfaceMultiplier::GetValue(Action* action)
     return 1.0f;
 }*/
 
-float IccAddsPutricideMultiplier::GetValue(Action* action)
+bool IccAddsPutricideMultiplier::IsActive()
 {
-    Unit* boss = AI_VALUE2(Unit*, "find target", "professor putricide");
-    if (!boss)
-    {
-        return 1.0f;
-    }
+    return AI_VALUE2(Unit*, "find target", "professor putricide") != nullptr;
+}
 
+float IccAddsPutricideMultiplier::GetValue(Action* action)
+{
     if (botAI->IsMainTank(bot))
     {
         Aura* aura = botAI->GetAura("mutated plague", bot, false, true);
@@ -298,15 +295,17 @@ float IccAddsPutricideMultiplier::GetValue(Action* action)
 }
 
 //bpc
+bool IccBpcAssistMultiplier::IsActive()
+{
+    Unit* keleseth = AI_VALUE2(Unit*, "find target", "prince keleseth");
+    return keleseth && keleseth->IsAlive();
+}
+
 float IccBpcAssistMultiplier::GetValue(Action* action)
 {
     if (!action)
         return 1.0f;
 
-    Unit* keleseth = AI_VALUE2(Unit*, "find target", "prince keleseth");
-    if (!keleseth || !keleseth->IsAlive())
-        return 1.0f;
-
     Aura* aura = botAI->GetAura("Shadow Prison", bot, false, true);
     if (aura) 
     {
@@ -386,6 +385,11 @@ float IccBpcAssistMultiplier::GetValue(Action* action)
 }
 
 //BQL
+bool IccBqlPactOfDarkfallenMultiplier::IsActive()
+{
+    return bot->HasAura(71340);
+}
+
 float IccBqlPactOfDarkfallenMultiplier::GetValue(Action* action)
 {
     if (!action)
@@ -394,19 +398,18 @@ float IccBqlPactOfDarkfallenMultiplier::GetValue(Action* action)
     if (action->getName() == "icc bql pact of darkfallen")
         return 1.0f;
 
-    // If bot has Pact of Darkfallen aura, return 0 for all other actions
-    if (bot->HasAura(71340))
-        return 0.0f;
+    // Bot has Pact of Darkfallen aura, return 0 for all other actions
+    return 0.0f;
+}
 
-    return 1.0f;
+bool IccBqlVampiricBiteMultiplier::IsActive()
+{
+    boss = AI_VALUE2(Unit*, "find target", "blood-queen lana'thel");
+    return boss != nullptr;
 }
 
 float IccBqlVampiricBiteMultiplier::GetValue(Action* action)
 {
-    Unit* boss = AI_VALUE2(Unit*, "find target", "blood-queen lana'thel");
-    if (!boss)
-        return 1.0f;
-
     Aura* aura = botAI->GetAura("Frenzied Bloodthirst", bot);
 
     if (botAI->IsMelee(bot) && ((boss->GetPositionZ() - bot->GetPositionZ()) > 5.0f) && !aura)
@@ -436,13 +439,15 @@ float IccBqlVampiricBiteMultiplier::GetValue(Action* action)
 }
 
 //VDW
-float IccValithriaDreamCloudMultiplier::GetValue(Action* action)
+bool IccValithriaDreamCloudMultiplier::IsActive()
 {
-    if (!bot->HasAura(70766))
-        return 1.0f;
+    return bot->HasAura(70766);
+}
 
-    // If bot is in dream state, prioritize cloud collection over other actions
-    if (bot->HasAura(70766) && dynamic_cast<IccValithriaDreamCloudAction*>(action))
+float IccValithriaDreamCloudMultiplier::GetValue(Action* action)
+{
+    // Bot is in dream state, prioritize cloud collection over other actions
+    if (dynamic_cast<IccValithriaDreamCloudAction*>(action))
         return 2.0f;
     else if (dynamic_cast<FollowAction*>(action))
         return 0.0f;
@@ -451,12 +456,13 @@ float IccValithriaDreamCloudMultiplier::GetValue(Action* action)
 }
 
 //SINDRAGOSA
-float IccSindragosaTankPositionMultiplier::GetValue(Action* action)
+bool IccSindragosaTankPositionMultiplier::IsActive()
 {
-    Unit* boss = AI_VALUE2(Unit*, "find target", "sindragosa");
-    if (!boss)
-        return 1.0f;
+    return AI_VALUE2(Unit*, "find target", "sindragosa") != nullptr;
+}
 
+float IccSindragosaTankPositionMultiplier::GetValue(Action* action)
+{
     if (dynamic_cast<IccSindragosaTankPositionAction*>(action))
         return 1.0f;
     else if (dynamic_cast<CombatFormationMoveAction*>(action))
@@ -464,12 +470,13 @@ float IccSindragosaTankPositionMultiplier::GetValue(Action* action)
     return 1.0f;
 }
 
-float IccSindragosaFrostBeaconMultiplier::GetValue(Action* action)
+bool IccSindragosaFrostBeaconMultiplier::IsActive()
 {
-    Unit* boss = AI_VALUE2(Unit*, "find target", "sindragosa");
-    if (!boss)
-        return 1.0f;
+    return AI_VALUE2(Unit*, "find target", "sindragosa") != nullptr;
+}
 
+float IccSindragosaFrostBeaconMultiplier::GetValue(Action* action)
+{
     if (!dynamic_cast<IccSindragosaFrostBeaconAction*>(action))
         return 1.0f;
 
@@ -498,12 +505,14 @@ float IccSindragosaFrostBeaconMultiplier::GetValue(Action* action)
     return 1.0f;
 }
 
-float IccSindragosaBlisteringColdPriorityMultiplier::GetValue(Action* action)
+bool IccSindragosaBlisteringColdPriorityMultiplier::IsActive()
 {
-    Unit* boss = AI_VALUE2(Unit*, "find target", "sindragosa");
-    if (!boss)
-        return 1.0f;
+    boss = AI_VALUE2(Unit*, "find target", "sindragosa");
+    return boss != nullptr;
+}
 
+float IccSindragosaBlisteringColdPriorityMultiplier::GetValue(Action* action)
+{
     // Check if boss is casting blistering cold (using both normal and heroic spell IDs)
     if (boss->HasUnitState(UNIT_STATE_CASTING) && 
         (boss->FindCurrentSpellBySpellId(70123) || boss->FindCurrentSpellBySpellId(71047) || 
@@ -521,12 +530,14 @@ float IccSindragosaBlisteringColdPriorityMultiplier::GetValue(Action* action)
     return 1.0f;
 }
 
-float IccSindragosaMysticBuffetMultiplier::GetValue(Action* action)
+bool IccSindragosaMysticBuffetMultiplier::IsActive()
 {
-    Unit* boss = AI_VALUE2(Unit*, "find target", "sindragosa");
-    if (!boss)
-        return 1.0f;
+    boss = AI_VALUE2(Unit*, "find target", "sindragosa");
+    return boss != nullptr;
+}
 
+float IccSindragosaMysticBuffetMultiplier::GetValue(Action* action)
+{
     if (botAI->IsMainTank(bot))
     {
         Aura* aura = botAI->GetAura("mystic buffet", bot, false, true);
@@ -565,13 +576,13 @@ float IccSindragosaMysticBuffetMultiplier::GetValue(Action* action)
     return 1.0f;
 }
 
-float IccSindragosaFrostBombMultiplier::GetValue(Action* action)
+bool IccSindragosaFrostBombMultiplier::IsActive()
 {
+    return AI_VALUE2(Unit*, "find target", "sindragosa") != nullptr;
+}
 
-    Unit* boss = AI_VALUE2(Unit*, "find target", "sindragosa");
-    if (!boss)
-        return 1.0f;
-
+float IccSindragosaFrostBombMultiplier::GetValue(Action* action)
+{
     float const MAX_REACTION_RANGE = 200.0f;
 
     // Check if there's an active frost bomb marker within range
@@ -676,11 +687,14 @@ float IccLichKingNecroticPlagueMultiplier::GetValue(Action* action)
     return 1.0f;
 }
 
+bool IccLichKingAddsMultiplier::IsActive()
+{
+    boss = AI_VALUE2(Unit*, "find target", "the lich king");
+    return boss != nullptr;
+}
+
 float IccLichKingAddsMultiplier::GetValue(Action* action)
 {
-    Unit* boss = AI_VALUE2(Unit*, "find target", "the lich king");
-    if (!boss)
-        return 1.0f;
     Unit* currentTarget = AI_VALUE(Unit*, "current target");
 
     if (dynamic_cast<IccLichKingWinterAction*>(action))
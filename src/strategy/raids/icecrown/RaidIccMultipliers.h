@@ -3,12 +3,15 @@
 
 #include "Multiplier.h"
 
+class Unit;
+
 //Lady Deathwhisper
 class IccLadyDeathwhisperMultiplier : public Multiplier
 {
 public:
     IccLadyDeathwhisperMultiplier(PlayerbotAI* ai) : Multiplier(ai, "icc lady deathwhisper") {}
     virtual float GetValue(Action* action);
+    bool IsActive() override;
 };
 
 //DBS
@@ -17,6 +20,7 @@ class IccAddsDbsMultiplier : public Multiplier
 public:
     IccAddsDbsMultiplier(PlayerbotAI* ai) : Multiplier(ai, "icc adds dbs") {}
     virtual float GetValue(Action* action);
+    bool IsActive() override;
 };
 
 //DOGS
@@ -26,6 +30,7 @@ class IccDogsMultiplier : public Multiplier
 public:
     IccDogsMultiplier(PlayerbotAI* ai) : Multiplier(ai, "icc dogs") {}
     virtual float GetValue(Action* action);
+    bool IsActive() override;
 };
 
 //FESTERGUT
@@ -34,6 +39,7 @@ class IccFestergutMultiplier : public Multiplier
 public:
     IccFestergutMultiplier(PlayerbotAI* ai) : Multiplier(ai, "icc festergut") {}
     virtual float GetValue(Action* action);
+    bool IsActive() override;
 };
 
 //ROTFACE
@@ -42,6 +48,10 @@ class IccRotfaceMultiplier : public Multiplier
 public:
     IccRotfaceMultiplier(PlayerbotAI* ai) : Multiplier(ai, "icc rotface") {}
     virtual float GetValue(Action* action);
+    bool IsActive() override;
+
+private:
+    Unit* boss = nullptr;  // resolved by IsActive for the tick
 };
 
 /*class IccRotfaceGroupPositionMultiplier : public Multiplier
@@ -57,6 +67,7 @@ class IccAddsPutricideMultiplier : public Multiplier
 public:
     IccAddsPutricideMultiplier(PlayerbotAI* ai) : Multiplier(ai, "icc adds putricide") {}
     virtual float GetValue(Action* action);
+    bool IsActive() override;
 };
 
 //BPC
@@ -65,6 +76,7 @@ class IccBpcAssistMultiplier : public Multiplier
 public:
     IccBpcAssistMultiplier(PlayerbotAI* botAI) : Multiplier(botAI, "icc bpc assist") {}
     virtual float GetValue(Action* action);
+    bool IsActive() override;
 };
 
 //BQL
@@ -73,6 +85,7 @@ class IccBqlPactOfDarkfallenMultiplier : public Multiplier
 public:
     IccBqlPactOfDarkfallenMultiplier(PlayerbotAI* botAI) : Multiplier(botAI, "icc bql pact of darkfallen multiplier") {}    
     virtual float GetValue(Action* action) override;
+    bool IsActive() override;
 };
 
 class IccBqlVampiricBiteMultiplier : public Multiplier
@@ -80,6 +93,10 @@ class IccBqlVampiricBiteMultiplier : public Multiplier
 public:
     IccBqlVampiricBiteMultiplier(PlayerbotAI* ai) : Multiplier(ai, "icc bql vampiric bite") {}
     virtual float GetValue(Action* action);
+    bool IsActive() override;
+
+private:
+    Unit* boss = nullptr;  // resolved by IsActive for the tick
 };
 
 //VDW
@@ -88,6 +105,7 @@ class IccValithriaDreamCloudMultiplier : public Multiplier
 public:
     IccValithriaDreamCloudMultiplier(PlayerbotAI* ai) : Multiplier(ai, "icc valithria dream cloud") {}
     virtual float GetValue(Action* action);
+    bool IsActive() override;
 };
 
 //SINDRAGOSA
@@ -96,6 +114,7 @@ class IccSindragosaTankPositionMultiplier : public Multiplier
 public:
     IccSindragosaTankPositionMultiplier(PlayerbotAI* ai) : Multiplier(ai, "icc sindragosa tank position") {}
     virtual float GetValue(Action* action);
+    bool IsActive() override;
 };
 
 class IccSindragosaFrostBeaconMultiplier : public Multiplier
@@ -103,6 +122,7 @@ class IccSindragosaFrostBeaconMultiplier : public Multiplier
 public:
     IccSindragosaFrostBeaconMultiplier(PlayerbotAI* ai) : Multiplier(ai, "icc sindragosa frost beacon") {}
     virtual float GetValue(Action* action);
+    bool IsActive() override;
 };
 
 /*class IccSindragosaFlyingMultiplier : public Multiplier
@@ -117,6 +137,10 @@ class IccSindragosaMysticBuffetMultiplier : public Multiplier
 public:
     IccSindragosaMysticBuffetMultiplier(PlayerbotAI* ai) : Multiplier(ai, "icc sindragosa mystic buffet") {}
     virtual float GetValue(Action* action);
+    bool IsActive() override;
+
+private:
+    Unit* boss = nullptr;  // resolved by IsActive for the tick
 };
 
 class IccSindragosaBlisteringColdPriorityMultiplier : public Multiplier
@@ -125,6 +149,10 @@ public:
     IccSindragosaBlisteringColdPriorityMultiplier(PlayerbotAI* ai) : Multiplier(ai, "sindragosa blistering cold priority") {}
 
     virtual float GetValue(Action* action) override;
+    bool IsActive() override;
+
+private:
+    Unit* boss = nullptr;  // resolved by IsActive for the tick
 };
 
 class IccSindragosaFrostBombMultiplier : public Multiplier
@@ -132,6 +160,7 @@ class IccSindragosaFrostBombMultiplier : public Multiplier
 public:
     IccSindragosaFrostBombMultiplier(PlayerbotAI* ai) : Multiplier(ai, "icc sindragosa frost bomb") {}
     virtual float GetValue(Action* action);
+    bool IsActive() override;
 };
 
 class IccLichKingNecroticPlagueMultiplier : public Multiplier
@@ -146,6 +175,10 @@ class IccLichKingAddsMultiplier : public Multiplier
 public:
     IccLichKingAddsMultiplier(PlayerbotAI* ai) : Multiplier(ai, "icc lich king adds") {}
     virtual float GetValue(Action* action);
+    bool IsActive() override;
+
+private:
+    Unit* boss = nullptr;  // resolved by IsActive for the tick
 };
 
 
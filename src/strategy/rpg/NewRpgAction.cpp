@@ -6,6 +6,7 @@
 #include "NewRpgStrategy.h"
 #include "ObjectDefines.h"
 #include "ObjectGuid.h"
+#include "PathCache.h"
 #include "PathGenerator.h"
 #include "Player.h"
 #include "PlayerbotAI.h"
@@ -276,16 +277,16 @@ bool NewRpgGoFarAwayPosAction::MoveFarTo(WorldPosition dest)
         float dx = x + cos(angle) * dis;
         float dy = y + sin(angle) * dis;
         float dz = z + 0.5f;
-        PathGenerator path(bot);
-        path.CalculatePath(dx, dy, dz);
-        PathType type = path.GetPathType();
+        CachedPath path;
+        sPathCache->CalculatePath(bot, dx, dy, dz, false, path);
+        PathType type = path.type;
         uint32 typeOk = PATHFIND_NORMAL | PATHFIND_INCOMPLETE | PATHFIND_FARFROMPOLY;
         bool canReach = !(type & (~typeOk));
 
         if (canReach && fabs(delta) <= minDelta)
         {
             found = true;
-            const G3D::Vector3& endPos = path.GetActualEndPosition();
+            const G3D::Vector3& endPos = path.actualEnd;
             rx = endPos.x;
             ry = endPos.y;
             rz = endPos.z;
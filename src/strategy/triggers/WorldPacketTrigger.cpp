@@ -7,7 +7,7 @@
 
 #include "Playerbots.h"
 
-void WorldPacketTrigger::ExternalEvent(WorldPacket& revData, Player* eventOwner)
+void WorldPacketTrigger::ExternalEvent(std::shared_ptr<WorldPacket const> const& revData, Player* eventOwner)
 {
     packet = revData;
     owner = eventOwner;
@@ -16,10 +16,14 @@ void WorldPacketTrigger::ExternalEvent(WorldPacket& revData, Player* eventOwner)
 
 Event WorldPacketTrigger::Check()
 {
-    if (!triggered)
+    if (!triggered || !packet)
         return Event();
 
     return Event(getName(), packet, owner);
 }
 
-void WorldPacketTrigger::Reset() { triggered = false; }
+void WorldPacketTrigger::Reset()
+{
+    triggered = false;
+    packet.reset();
+}
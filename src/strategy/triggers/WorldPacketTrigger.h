@@ -6,6 +6,8 @@
 #ifndef _PLAYERBOT_WORLDPACKETTRIGGER_H
 #define _PLAYERBOT_WORLDPACKETTRIGGER_H
 
+#include <memory>
+
 #include "Trigger.h"
 
 class Event;
@@ -18,12 +20,12 @@ class WorldPacketTrigger : public Trigger
 public:
     WorldPacketTrigger(PlayerbotAI* botAI, std::string const command) : Trigger(botAI, command), triggered(false) {}
 
-    void ExternalEvent(WorldPacket& packet, Player* owner = nullptr) override;
+    void ExternalEvent(std::shared_ptr<WorldPacket const> const& packet, Player* owner = nullptr) override;
     Event Check() override;
     void Reset() override;
 
 private:
-    WorldPacket packet;
+    std::shared_ptr<WorldPacket const> packet;
     bool triggered;
     Player* owner;
 };
@@ -248,20 +248,8 @@ public:
         float z = master->GetPositionZ();
         float orientation = master->GetOrientation();
 
-        std::vector<Player*> players;
-        GroupReference* gref = group->GetFirstMember();
-        while (gref)
-        {
-            Player* member = gref->GetSource();
-            if (member != master)
-                players.push_back(member);
-
-            gref = gref->next();
-        }
-
-        players.insert(players.begin() + group->GetMembersCount() / 2, master);
-
-        return MoveLine(players, 0.0f, x, y, z, orientation, range);
+        std::shared_ptr<FormationLayout const> layout = sFormationSolver->GetLayout(group, master, bot->GetMapId());
+        return MoveLine(layout->GetLineSlot(layout->line, bot->GetGUID()), 0.0f, x, y, z, orientation, range);
     }
 };
 
@@ -287,50 +275,32 @@ public:
         float z = master->GetPositionZ();
         float orientation = master->GetOrientation();
 
-        std::vector<Player*> tanks;
-        std::vector<Player*> dps;
-        GroupReference* gref = group->GetFirstMember();
-        while (gref)
-        {
-            Player* member = gref->GetSource();
-            if (member != master)
-            {
-                if (botAI->IsTank(member))
-                    tanks.push_back(member);
-                else
-                    dps.push_back(member);
-            }
-
-            gref = gref->next();
-        }
+        std::shared_ptr<FormationLayout const> layout = sFormationSolver->GetLayout(group, master, bot->GetMapId());
+        FormationLineSlot const* tankSlot = layout->GetLineSlot(layout->shieldTanks, bot->GetGUID());
+        FormationLineSlot const* dpsSlot = layout->GetLineSlot(layout->shieldDps, bot->GetGUID());
 
-        if (botAI->IsTank(master))
-            tanks.insert(tanks.begin() + (tanks.size() + 1) / 2, master);
-        else
-            dps.insert(dps.begin() + (dps.size() + 1) / 2, master);
-
-        if (botAI->IsTank(bot) && botAI->IsTank(master))
+        if (tankSlot && layout->masterIsTank)
         {
-            return MoveLine(tanks, 0.0f, x, y, z, orientation, range);
+            return MoveLine(tankSlot, 0.0f, x, y, z, orientation, range);
         }
 
-        if (!botAI->IsTank(bot) && !botAI->IsTank(master))
+        if (dpsSlot && !layout->masterIsTank)
         {
-            return MoveLine(dps, 0.0f, x, y, z, orientation, range);
+            return MoveLine(dpsSlot, 0.0f, x, y, z, orientation, range);
         }
 
-        if (botAI->IsTank(bot) && !botAI->IsTank(master))
+        if (tankSlot && !layout->masterIsTank)
         {
-            float diff = tanks.size() % 2 == 0 ? -sPlayerbotAIConfig->tooCloseDistance / 2.0f : 0.0f;
-            return MoveLine(tanks, diff, x + cos(orientation) * range, y + sin(orientation) * range, z, orientation,
-                            range);
+            float diff = layout->shieldTanksSize % 2 == 0 ? -sPlayerbotAIConfig->tooCloseDistance / 2.0f : 0.0f;
+            return MoveLine(tankSlot, diff, x + cos(orientation) * range, y + sin(orientation) * range, z,
+                            orientation, range);
         }
 
-        if (!botAI->IsTank(bot) && botAI->IsTank(master))
+        if (dpsSlot && layout->masterIsTank)
         {
-            float diff = dps.size() % 2 == 0 ? -sPlayerbotAIConfig->tooCloseDistance / 2.0f : 0.0f;
-            return MoveLine(dps, diff, x - cos(orientation) * range, y - sin(orientation) * range, z, orientation,
-                            range);
+            float diff = layout->shieldDpsSize % 2 == 0 ? -sPlayerbotAIConfig->tooCloseDistance / 2.0f : 0.0f;
+            return MoveLine(dpsSlot, diff, x - cos(orientation) * range, y - sin(orientation) * range, z,
+                            orientation, range);
         }
 
         return Formation::NullLocation;
@@ -411,7 +381,6 @@ float Formation::GetFollowAngle()
 {
     Player* master = GetMaster();
     Group* group = bot->GetGroup();
-    PlayerbotAI* botAI = GET_PLAYERBOT_AI(bot);
 
     // If there's no master and no group
     if (!master && !group)
@@ -420,49 +389,14 @@ float Formation::GetFollowAngle()
     uint32 index = 1;
     uint32 total = 1;
 
-    std::vector<Player*> roster;
-
     if (group)
     {
-        bool left = true;  // Used for alternating tanks' positions
-
-        for (GroupReference* ref = group->GetFirstMember(); ref; ref = ref->next())
-        {
-            Player* member = ref->GetSource();
-
-            // Skip invalid, dead, or out-of-map members
-            if (!member || !member->IsAlive() || bot->GetMapId() != member->GetMapId())
-                continue;
-
-            // Skip the master
-            if (member == master)
-                continue;
-
-            // Put DPS in the middle
-            if (!botAI->IsTank(member) && !botAI->IsHeal(member))
-            {
-                roster.insert(roster.begin() + roster.size() / 2, member);
-            }
-
-            // Put Healers in the middle
-            else if (botAI->IsHeal(member))
-            {
-                roster.insert(roster.begin() + roster.size() / 2, member);
-            }
-
-            // Handle tanks (alternate between front and back)
-            else if (botAI->IsTank(member))
-            {
-                if (left)
-                    roster.push_back(member);  // Place tank at the back
-                else
-                    roster.insert(roster.begin(), member);  // Place tank at the front
-
-                left = !left;  // Alternate for the next tank
-            }
+        // Roles put DPS and healers in the middle and alternate tanks between front and back, see FormationSolver
+        std::shared_ptr<FormationLayout const> layout = sFormationSolver->GetLayout(group, master, bot->GetMapId());
+        if (uint32 followIndex = layout->GetFollowIndex(bot->GetGUID()))
+            index = followIndex;
 
-            total++;
-        }
+        total = layout->followTotal;
     }
     else if (master)
     {
@@ -482,13 +416,6 @@ float Formation::GetFollowAngle()
         }
     }
 
-    // Find the bot's position in the roster
-    auto it = std::find(roster.begin(), roster.end(), bot);
-    if (it != roster.end())
-    {
-        index = std::distance(roster.begin(), it) + 1;  // Find bot's index in the roster
-    }
-
     // Return
     float start = (master ? master->GetOrientation() : 0.0f);
     return start + (0.125f + 1.75f * index / total + (total == 2 ? 0.125f : 0.0f)) * M_PI;
@@ -619,70 +546,33 @@ bool SetFormationAction::Execute(Event event)
     return true;
 }
 
-WorldLocation MoveFormation::MoveLine(std::vector<Player*> line, float diff, float cx, float cy, float cz,
+WorldLocation MoveFormation::MoveLine(FormationLineSlot const* slot, float diff, float cx, float cy, float cz,
                                       float orientation, float range)
 {
-    if (line.size() < 5)
-    {
-        return MoveSingleLine(line, diff, cx, cy, cz, orientation, range);
-    }
-
-    uint32 lines = ceil((double)line.size() / 5.0);
-    for (uint32 i = 0; i < lines; i++)
-    {
-        float radius = range * i;
-        float x = cx + cos(orientation) * radius;
-        float y = cy + sin(orientation) * radius;
-
-        std::vector<Player*> singleLine;
-        for (uint32 j = 0; j < 5 && !line.empty(); j++)
-        {
-            singleLine.push_back(line[line.size() - 1]);
-            line.pop_back();
-        }
-
-        WorldLocation loc = MoveSingleLine(singleLine, diff, x, y, cz, orientation, range);
-        if (!Formation::IsNullLocation(loc))
-            return loc;
-    }
-
-    return Formation::NullLocation;
-}
+    if (!slot)
+        return Formation::NullLocation;
 
-WorldLocation MoveFormation::MoveSingleLine(std::vector<Player*> line, float diff, float cx, float cy, float cz,
-                                            float orientation, float range)
-{
-    float count = line.size();
+    float radius = range * slot->row;
+    float count = slot->rowSize;
     float angle = orientation - M_PI / 2.0f;
-    float x = cx + cos(angle) * (range * floor(count / 2.0f) + diff);
-    float y = cy + sin(angle) * (range * floor(count / 2.0f) + diff);
+    float x = cx + cos(orientation) * radius + cos(angle) * (range * floor(count / 2.0f) + diff);
+    float y = cy + sin(orientation) * radius + sin(angle) * (range * floor(count / 2.0f) + diff);
 
-    uint32 index = 0;
-    for (Player* member : line)
-    {
-        if (member == bot)
-        {
-            float angle = orientation + M_PI / 2.0f;
-            float radius = range * index;
+    angle = orientation + M_PI / 2.0f;
+    radius = range * slot->column;
 
-            float lx = x + cos(angle) * radius;
-            float ly = y + sin(angle) * radius;
-            float lz = cz;
+    float lx = x + cos(angle) * radius;
+    float ly = y + sin(angle) * radius;
+    float lz = cz;
 
-            Player* master = botAI->GetMaster();
-            if (!master || !master->GetMap()->CheckCollisionAndGetValidCoords(
-                    master, master->GetPositionX(), master->GetPositionY(), master->GetPositionZ(), lx, ly, lz))
-            {
-                lx = x + cos(angle) * radius;
-                ly = y + sin(angle) * radius;
-                lz = cz;
-            }
-
-            return WorldLocation(bot->GetMapId(), lx, ly, lz);
-        }
-
-        ++index;
+    Player* master = botAI->GetMaster();
+    if (!master || !master->GetMap()->CheckCollisionAndGetValidCoords(
+            master, master->GetPositionX(), master->GetPositionY(), master->GetPositionZ(), lx, ly, lz))
+    {
+        lx = x + cos(angle) * radius;
+        ly = y + sin(angle) * radius;
+        lz = cz;
     }
 
-    return Formation::NullLocation;
+    return WorldLocation(bot->GetMapId(), lx, ly, lz);
 }
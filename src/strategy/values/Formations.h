@@ -7,6 +7,7 @@
 #define _PLAYERBOT_FORMATIONS_H
 
 #include "Action.h"
+#include "FormationSolver.h"
 #include "NamedObjectContext.h"
 #include "PlayerbotAIConfig.h"
 #include "TravelMgr.h"
@@ -41,10 +42,8 @@ public:
     MoveFormation(PlayerbotAI* botAI, std::string const name) : Formation(botAI, name) {}
 
 protected:
-    WorldLocation MoveLine(std::vector<Player*> line, float diff, float cx, float cy, float cz, float orientation,
+    WorldLocation MoveLine(FormationLineSlot const* slot, float diff, float cx, float cy, float cz, float orientation,
                            float range);
-    WorldLocation MoveSingleLine(std::vector<Player*> line, float diff, float cx, float cy, float cz, float orientation,
-                                 float range);
 };
 
 class MoveAheadFormation : public MoveFormation
@@ -7,6 +7,7 @@
 
 #include "AiFactory.h"
 #include "ChatHelper.h"
+#include "CraftSpellIndex.h"
 #include "GuildTaskMgr.h"
 #include "PlayerbotAIConfig.h"
 #include "PlayerbotFactory.h"
@@ -693,28 +694,13 @@ std::vector<uint32> ItemUsageValue::SpellsUsingItem(uint32 itemId, Player* bot)
 {
     std::vector<uint32> retSpells;
 
-    PlayerSpellMap const& spellMap = bot->GetSpellMap();
-
-    for (auto& spell : spellMap)
+    for (CraftSpell const& craft : sCraftSpellIndex->GetSpellsUsingReagent(itemId))
     {
-        uint32 spellId = spell.first;
-
-        if (spell.second->State == PLAYERSPELL_REMOVED || !spell.second->Active)
-            continue;
-
-        SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
-        if (!spellInfo)
-            continue;
-
-        if (spellInfo->IsPassive())
-            continue;
-
-        if (spellInfo->Effects[EFFECT_0].Effect != SPELL_EFFECT_CREATE_ITEM)
+        if (craft.skillId && bot->GetPureSkillValue(craft.skillId) < craft.minSkill)
             continue;
 
-        for (uint8 i = 0; i < MAX_SPELL_REAGENTS; i++)
-            if (spellInfo->ReagentCount[i] > 0 && spellInfo->Reagent[i] == itemId)
-                retSpells.push_back(spellId);
+        if (bot->HasActiveSpell(craft.spellId))
+            retSpells.push_back(craft.spellId);
     }
 
     return retSpells;
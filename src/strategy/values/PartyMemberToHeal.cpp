@@ -27,73 +27,143 @@ public:
 
 inline bool compareByHealth(Unit const* u1, Unit const* u2) { return u1->GetHealthPct() < u2->GetHealthPct(); }
 
-Unit* PartyMemberToHeal::Calculate()
+namespace
 {
-    IsTargetOfHealingSpell predicate;
+// Flat per-candidate data for heal triage. Everything cheap is gathered in one pass over the group,
+// scored in a second pass and only the best scored candidates are tested for line of sight.
+struct HealTriage
+{
+    std::vector<Unit*> units;
+    std::vector<uint32> health;
+    std::vector<float> distance;
+    std::vector<uint8> incomingHeal;
+    std::vector<uint8> isMinion;
+    std::vector<uint32> score;
+
+    void Reserve(size_t size)
+    {
+        units.reserve(size);
+        health.reserve(size);
+        distance.reserve(size);
+        incomingHeal.reserve(size);
+        isMinion.reserve(size);
+    }
+
+    void Add(Unit* unit, float dist, bool incoming, bool minion)
+    {
+        units.push_back(unit);
+        health.push_back(uint8(unit->GetHealthPct()));
+        distance.push_back(dist);
+        incomingHeal.push_back(incoming);
+        isMinion.push_back(minion);
+    }
+
+    // lower is more urgent, 100 and above is never healed
+    void Score(bool isRaid, uint32 mediumHealth, float healDistance)
+    {
+        size_t const size = units.size();
+        score.resize(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            uint32 const hp = health[i];
+            bool const urgent = isRaid | (hp < mediumHealth);
+            uint32 const farScore = hp + 30;
+            uint32 const nearScore = hp + uint32(distance[i] / 10);
+            uint32 const rangeScore = distance[i] > healDistance ? farScore : nearScore;
+            uint32 const playerScore = (urgent | !incomingHeal[i]) ? rangeScore : 100;
+            uint32 const minionScore = urgent ? farScore : 100;
+            score[i] = isMinion[i] ? minionScore : playerScore;
+        }
+    }
+};
+}  // namespace
 
+Unit* PartyMemberToHeal::Calculate()
+{
     Group* group = bot->GetGroup();
     if (!group)
         return bot;
 
-    bool isRaid = bot->GetGroup()->isRaidGroup();
-    MinValueCalculator calc(100);
+    bool isRaid = group->isRaidGroup();
+
+    IsTargetOfHealingSpell predicate;
+    GuidVector healTargets;
+    if (!isRaid)
+        GetTargetsOfSpellCast(predicate, healTargets);
+
+    float const maxDistance = sPlayerbotAIConfig->healDistance * 2;
+    uint32 const mapId = bot->GetMapId();
+
+    HealTriage triage;
+    triage.Reserve(group->GetMembersCount() * 2);
 
     for (GroupReference* gref = group->GetFirstMember(); gref; gref = gref->next())
     {
         Player* player = gref->GetSource();
-        if (player->IsGameMaster())
+        if (!player || player->IsGameMaster() || player->GetMapId() != mapId)
             continue;
-        if (player && player->IsAlive())
+
+        if (player->IsAlive())
         {
-            uint8 health = player->GetHealthPct();
-            if (isRaid || health < sPlayerbotAIConfig->mediumHealth || !IsTargetOfSpellCast(player, predicate))
+            float distance = player->GetDistance2d(bot);
+            if (distance < maxDistance)
             {
-                uint32 probeValue = 100;
-                if (player->GetDistance2d(bot) > sPlayerbotAIConfig->healDistance)
-                {
-                    probeValue = health + 30;
-                }
-                else
-                {
-                    probeValue = health + player->GetDistance2d(bot) / 10;
-                }
-                // delay Check player to here for better performance
-                if (probeValue < calc.minValue && Check(player))
+                bool incoming = false;
+                if (!healTargets.empty())
                 {
-                    calc.probe(probeValue, player);
+                    ObjectGuid corpseGuid = player->GetCorpse() ? player->GetCorpse()->GetGUID() : ObjectGuid::Empty;
+                    for (ObjectGuid const guid : healTargets)
+                    {
+                        if (guid == player->GetGUID() || (corpseGuid && guid == corpseGuid))
+                        {
+                            incoming = true;
+                            break;
+                        }
+                    }
                 }
+
+                triage.Add(player, distance, incoming, false);
             }
         }
 
         Pet* pet = player->GetPet();
         if (pet && pet->IsAlive())
         {
-            uint8 health = ((Unit*)pet)->GetHealthPct();
-            uint32 probeValue = 100;
-            if (isRaid || health < sPlayerbotAIConfig->mediumHealth)
-                probeValue = health + 30;
-            // delay Check pet to here for better performance
-            if (probeValue < calc.minValue && Check(pet))
-            {
-                calc.probe(probeValue, pet);
-            }
+            float distance = pet->GetDistance2d(bot);
+            if (distance < maxDistance)
+                triage.Add(pet, distance, false, true);
         }
 
         Unit* charm = player->GetCharm();
-        if (charm && charm->IsAlive())
+        if (charm && charm->IsAlive() && charm->GetMapId() == mapId)
         {
-            uint8 health = charm->GetHealthPct();
-            uint32 probeValue = 100;
-            if (isRaid || health < sPlayerbotAIConfig->mediumHealth)
-                probeValue = health + 30;
-            // delay Check charm to here for better performance
-            if (probeValue < calc.minValue && Check(charm))
-            {
-                calc.probe(probeValue, charm);
-            }
+            float distance = charm->GetDistance2d(bot);
+            if (distance < maxDistance)
+                triage.Add(charm, distance, false, true);
         }
     }
-    return (Unit*)calc.param;
+
+    triage.Score(isRaid, sPlayerbotAIConfig->mediumHealth, sPlayerbotAIConfig->healDistance);
+
+    std::vector<uint32> order;
+    order.reserve(triage.units.size());
+    for (uint32 i = 0; i < triage.units.size(); ++i)
+    {
+        if (triage.score[i] < 100)
+            order.push_back(i);
+    }
+
+    std::stable_sort(order.begin(), order.end(),
+                     [&triage](uint32 lhs, uint32 rhs) { return triage.score[lhs] < triage.score[rhs]; });
+
+    // delay Check (line of sight) to here for better performance
+    for (uint32 i : order)
+    {
+        if (Check(triage.units[i]))
+            return triage.units[i];
+    }
+
+    return nullptr;
 }
 
 bool PartyMemberToHeal::Check(Unit* player)
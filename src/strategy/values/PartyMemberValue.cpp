@@ -147,6 +147,33 @@ bool PartyMemberValue::IsTargetOfSpellCast(Player* target, SpellEntryPredicate&
     return false;
 }
 
+void PartyMemberValue::GetTargetsOfSpellCast(SpellEntryPredicate& predicate, GuidVector& targets)
+{
+    Group* group = bot->GetGroup();
+    if (!group)
+        return;
+
+    for (GroupReference* gref = group->GetFirstMember(); gref; gref = gref->next())
+    {
+        Player* player = gref->GetSource();
+        if (!player || player == bot || !player->IsNonMeleeSpellCast(true))
+            continue;
+
+        for (uint8 type = CURRENT_GENERIC_SPELL; type < CURRENT_MAX_SPELL; type++)
+        {
+            Spell* spell = player->GetCurrentSpell((CurrentSpellTypes)type);
+            if (!spell || !predicate.Check(spell->m_spellInfo))
+                continue;
+
+            if (ObjectGuid unitTarget = spell->m_targets.GetUnitTargetGUID())
+                targets.push_back(unitTarget);
+
+            if (ObjectGuid corpseTarget = spell->m_targets.GetCorpseTargetGUID())
+                targets.push_back(corpseTarget);
+        }
+    }
+}
+
 class FindMainTankPlayer : public FindPlayerPredicate
 {
 public:
@@ -33,6 +33,7 @@ public:
     }
 
     bool IsTargetOfSpellCast(Player* target, SpellEntryPredicate& predicate);
+    void GetTargetsOfSpellCast(SpellEntryPredicate& predicate, GuidVector& targets);
 
 protected:
     Unit* FindPartyMember(FindPlayerPredicate& predicate, bool ignoreOutOfGroup = false);
@@ -9,144 +9,15 @@
 #include "Playerbots.h"
 #include "SharedValueContext.h"
 
-// What kind of a relation does this entry have with this quest.
-entryQuestRelationMap EntryQuestRelationMapValue::Calculate()
-{
-    entryQuestRelationMap rMap;
-
-    for (auto relation : *sObjectMgr->GetCreatureQuestRelationMap())
-        rMap[relation.first][relation.second] |= (int)QuestRelationFlag::questGiver;
-
-    for (auto relation : *sObjectMgr->GetCreatureQuestInvolvedRelationMap())
-        rMap[relation.first][relation.second] |= (int)QuestRelationFlag::questTaker;
-
-    for (auto relation : *sObjectMgr->GetGOQuestRelationMap())
-        rMap[-(int32)relation.first][relation.second] |= (int)QuestRelationFlag::questGiver;
-
-    for (auto relation : *sObjectMgr->GetGOQuestInvolvedRelationMap())
-        rMap[-(int32)relation.first][relation.second] |= (int)QuestRelationFlag::questGiver;
-
-    // Quest objectives
-    ObjectMgr::QuestMap const& questMap = sObjectMgr->GetQuestTemplates();
-
-    for (auto& questItr : questMap)
-    {
-        uint32 questId = questItr.first;
-        Quest* quest = questItr.second;
-
-        for (uint32 objective = 0; objective < QUEST_OBJECTIVES_COUNT; objective++)
-        {
-            uint32 relationFlag = 1 << objective;
-
-            // Kill objective
-            if (quest->RequiredNpcOrGo[objective])
-                rMap[quest->RequiredNpcOrGo[objective]][questId] |= relationFlag;
-
-            // Loot objective
-            if (quest->RequiredItemId[objective])
-            {
-                for (auto& entry : GAI_VALUE2(std::vector<int32>, "item drop list", quest->RequiredItemId[objective]))
-                    rMap[entry][questId] |= relationFlag;
-            }
-        }
-    }
-
-    return rMap;
-}
-
-// Get all the objective entries for a specific quest.
-void FindQuestObjectData::GetObjectiveEntries()
-{
-    relationMap = GAI_VALUE(entryQuestRelationMap, "entry quest relation");
-}
-
-// Data worker. Checks for a specific creature what quest they are needed for and puts them in the proper place in the
-// quest map.
-void FindQuestObjectData::operator()(CreatureData const& creData)
-{
-    uint32 entry = creData.id1;
-
-    for (auto& relation : relationMap[entry])
-    {
-        uint32 questId = relation.first;
-        uint32 flag = relation.second;
-        data[questId][flag][entry].push_back(GuidPosition(creData));
-    }
-}
-
-// GameObject data worker. Checks for a specific gameObject what quest they are needed for and puts them in the proper
-// place in the quest map.
-void FindQuestObjectData::operator()(GameObjectData const& goData)
-{
-    int32 entry = goData.id * -1;
-
-    for (auto& relation : relationMap[entry])
-    {
-        uint32 questId = relation.first;
-        uint32 flag = relation.second;
-        data[questId][flag][entry].push_back(GuidPosition(goData));
-    }
-}
-
-// Goes past all creatures and gameobjects and creatures the full quest guid map.
-questGuidpMap QuestGuidpMapValue::Calculate()
-{
-    FindQuestObjectData worker;
-    for (auto const& itr : sObjectMgr->GetAllCreatureData())
-        worker(itr.second);
-    for (auto const& itr : sObjectMgr->GetAllGOData())
-        worker(itr.second);
-
-    return worker.GetResult();
-}
-
-// Selects all questgivers for a specific level (range).
-questGiverMap QuestGiversValue::Calculate()
-{
-    uint32 level = 0;
-    std::string const q = getQualifier();
-    bool hasQualifier = !q.empty();
-
-    if (hasQualifier)
-        level = stoi(q);
-
-    questGuidpMap questMap = GAI_VALUE(questGuidpMap, "quest guidp map");
-
-    questGiverMap guidps;
-
-    for (auto& qPair : questMap)
-    {
-        for (auto& entry : qPair.second[(int)QuestRelationFlag::questGiver])
-        {
-            for (auto& guidp : entry.second)
-            {
-                uint32 questId = qPair.first;
-
-                if (hasQualifier)
-                {
-                    Quest const* quest = sObjectMgr->GetQuestTemplate(questId);
-
-                    if (quest && (level < quest->GetMinLevel() || (int)level > quest->GetQuestLevel() + 10))
-                        continue;
-                }
-
-                guidps[questId].push_back(guidp);
-            }
-        }
-    }
-
-    return guidps;
-}
-
 std::vector<GuidPosition> ActiveQuestGiversValue::Calculate()
 {
-    questGiverMap qGivers = GAI_VALUE2(questGiverMap, "quest givers", bot->GetLevel());
+    questGiverList const& qGivers = sQuestIndex->GetQuestGivers(bot->GetLevel());
 
     std::vector<GuidPosition> retQuestGivers;
 
-    for (auto& qGiver : qGivers)
+    for (auto qGiver : qGivers)
     {
-        uint32 questId = qGiver.first;
+        uint32 questId = qGiver->first;
         Quest const* quest = sObjectMgr->GetQuestTemplate(questId);
         if (!quest)
         {
@@ -161,7 +32,7 @@ std::vector<GuidPosition> ActiveQuestGiversValue::Calculate()
         if (status != QUEST_STATUS_NONE)
             continue;
 
-        for (auto& guidp : qGiver.second)
+        for (auto guidp : qGiver->second)
         {
             CreatureTemplate const* creatureTemplate = guidp.GetCreatureTemplate();
 
@@ -185,8 +56,6 @@ std::vector<GuidPosition> ActiveQuestGiversValue::Calculate()
 
 std::vector<GuidPosition> ActiveQuestTakersValue::Calculate()
 {
-    questGuidpMap questMap = GAI_VALUE(questGuidpMap, "quest guidp map");
-
     std::vector<GuidPosition> retQuestTakers;
 
     QuestStatusMap& questStatusMap = bot->getQuestStatusMap();
@@ -207,17 +76,12 @@ std::vector<GuidPosition> ActiveQuestTakersValue::Calculate()
             (!quest->IsAutoComplete() || !bot->CanTakeQuest(quest, false)))
             continue;
 
-        auto q = questMap.find(questId);
-
-        if (q == questMap.end())
-            continue;
-
-        auto qt = q->second.find((int)QuestRelationFlag::questTaker);
+        questEntryGuidps const* takers = sQuestIndex->GetQuestRelations(questId, QuestRelationFlag::questTaker);
 
-        if (qt == q->second.end())
+        if (!takers)
             continue;
 
-        for (auto& entry : qt->second)
+        for (auto& entry : *takers)
         {
             if (entry.first > 0)
             {
@@ -229,7 +93,7 @@ std::vector<GuidPosition> ActiveQuestTakersValue::Calculate()
                 }
             }
 
-            for (auto& guidp : entry.second)
+            for (auto guidp : entry.second)
             {
                 if (guidp.isDead())
                     continue;
@@ -244,8 +108,6 @@ std::vector<GuidPosition> ActiveQuestTakersValue::Calculate()
 
 std::vector<GuidPosition> ActiveQuestObjectivesValue::Calculate()
 {
-    questGuidpMap questMap = GAI_VALUE(questGuidpMap, "quest guidp map");
-
     std::vector<GuidPosition> retQuestObjectives;
 
     QuestStatusMap& questStatusMap = bot->getQuestStatusMap();
@@ -284,19 +146,15 @@ std::vector<GuidPosition> ActiveQuestObjectivesValue::Calculate()
                     continue;
             }
 
-            auto q = questMap.find(questId);
-
-            if (q == questMap.end())
-                continue;
-
-            auto qt = q->second.find((int)QuestRelationFlag(1 << objective));
+            questEntryGuidps const* objectives =
+                sQuestIndex->GetQuestRelations(questId, QuestRelationFlag(1 << objective));
 
-            if (qt == q->second.end())
+            if (!objectives)
                 continue;
 
-            for (auto& entry : qt->second)
+            for (auto& entry : *objectives)
             {
-                for (auto& guidp : entry.second)
+                for (auto guidp : entry.second)
                 {
                     if (guidp.isDead())
                         continue;
@@ -7,91 +7,12 @@
 #define _PLAYERBOT_QUESTVALUES_H
 
 #include "NamedObjectContext.h"
-#include "TravelMgr.h"
+#include "QuestIndex.h"
 #include "Value.h"
 
 class Player;
 class PlayerbotAI;
 
-struct CreatureData;
-struct GameObjectData;
-
-enum class QuestRelationFlag : uint32
-{
-    none = 0,
-    objective1 = 1,
-    objective2 = 2,
-    objective3 = 4,
-    objective4 = 8,
-    questGiver = 16,
-    questTaker = 32,
-    maxQuestRelationFlag = 64
-};
-
-//                     questId, QuestRelationFlag
-typedef std::unordered_map<uint32, uint32> questRelationMap;
-//                     entry
-typedef std::unordered_map<int32, questRelationMap> entryQuestRelationMap;
-
-//                      entry
-typedef std::unordered_map<int32, std::vector<GuidPosition>> questEntryGuidps;
-
-//                      QuestRelationFlag
-typedef std::unordered_map<uint32, questEntryGuidps> questRelationGuidps;
-
-//                      questId
-typedef std::unordered_map<uint32, questRelationGuidps> questGuidpMap;
-
-//                      questId
-typedef std::unordered_map<uint32, std::vector<GuidPosition>> questGiverMap;
-
-// Returns the quest relation Flags for all entries and quests
-class EntryQuestRelationMapValue : public SingleCalculatedValue<entryQuestRelationMap>
-{
-public:
-    EntryQuestRelationMapValue(PlayerbotAI* botAI) : SingleCalculatedValue(botAI, "entry quest relation map") {}
-
-    entryQuestRelationMap Calculate() override;
-};
-
-// Generic quest object finder
-class FindQuestObjectData
-{
-public:
-    FindQuestObjectData() { GetObjectiveEntries(); }
-
-    void GetObjectiveEntries();
-    void operator()(CreatureData const& creatureData);
-    void operator()(GameObjectData const& gameobjectData);
-    questGuidpMap GetResult() const { return data; };
-
-private:
-    std::unordered_map<int32, std::vector<std::pair<uint32, QuestRelationFlag>>> entryMap;
-    std::unordered_map<uint32, std::vector<std::pair<uint32, QuestRelationFlag>>> itemMap;
-
-    entryQuestRelationMap relationMap;
-
-    questGuidpMap data;
-};
-
-// All objects to start, do or finish a quest.
-class QuestGuidpMapValue : public SingleCalculatedValue<questGuidpMap>
-{
-public:
-    QuestGuidpMapValue(PlayerbotAI* botAI) : SingleCalculatedValue(botAI, "quest guidp map") {}
-
-    questGuidpMap Calculate() override;
-};
-
-// All questgivers and their quests that are Useful for a specific level
-class QuestGiversValue : public SingleCalculatedValue<questGiverMap>, public Qualified
-{
-public:
-    QuestGiversValue(PlayerbotAI* botAI) : SingleCalculatedValue(botAI, "quest givers") {}
-
-    questGiverMap Calculate() override;
-};
-
 // All questgivers that have a quest for the bot.
 class ActiveQuestGiversValue : public CalculatedValue<std::vector<GuidPosition>>
 {
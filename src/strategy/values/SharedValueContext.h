@@ -23,10 +23,6 @@ public:
         creators["drop map"] = &SharedValueContext::drop_map;
         creators["item drop list"] = &SharedValueContext::item_drop_list;
         creators["entry loot list"] = &SharedValueContext::entry_loot_list;
-
-        creators["entry quest relation"] = &SharedValueContext::entry_quest_relation;
-        creators["quest guidp map"] = &SharedValueContext::quest_guidp_map;
-        creators["quest givers"] = &SharedValueContext::quest_givers;
     }
 
 private:
@@ -35,10 +31,6 @@ private:
     static UntypedValue* item_drop_list(PlayerbotAI* botAI) { return new ItemDropListValue(botAI); }
     static UntypedValue* entry_loot_list(PlayerbotAI* botAI) { return new EntryLootListValue(botAI); }
 
-    static UntypedValue* entry_quest_relation(PlayerbotAI* botAI) { return new EntryQuestRelationMapValue(botAI); }
-    static UntypedValue* quest_guidp_map(PlayerbotAI* botAI) { return new QuestGuidpMapValue(botAI); }
-    static UntypedValue* quest_givers(PlayerbotAI* botAI) { return new QuestGiversValue(botAI); }
-
     // Global acess functions
 public:
     static SharedValueContext* instance()
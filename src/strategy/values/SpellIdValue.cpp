@@ -6,6 +6,7 @@
 #include "SpellIdValue.h"
 
 #include "ChatHelper.h"
+#include "CraftSpellIndex.h"
 #include "Playerbots.h"
 #include "Vehicle.h"
 #include "World.h"
@@ -25,22 +26,28 @@ uint32 SpellIdValue::Calculate()
         if (SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(extractedSpellId))
             namepart = spellInfo->SpellName[0];
 
-    std::wstring wnamepart;
-    if (!Utf8toWStr(namepart, wnamepart))
-        return 0;
+    std::set<uint32> spellIds;
+    for (uint32 itemId : itemIds)
+    {
+        for (uint32 spellId : sCraftSpellIndex->GetSpellsCreatingItem(itemId))
+        {
+            if (!bot->HasActiveSpell(spellId))
+                continue;
 
-    wstrToLower(wnamepart);
-    char firstSymbol = tolower(namepart[0]);
-    int spellLength = wnamepart.length();
+            SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
+            if (!spellInfo || spellInfo->Effects[0].Effect == SPELL_EFFECT_LEARN_SPELL)
+                continue;
 
-    LocaleConstant loc = LOCALE_enUS;
+            spellIds.insert(spellId);
+        }
+    }
 
-    std::set<uint32> spellIds;
-    for (PlayerSpellMap::iterator itr = bot->GetSpellMap().begin(); itr != bot->GetSpellMap().end(); ++itr)
+    std::vector<uint32> const& namedSpellIds = botAI->GetSpellIdsByName(namepart);
+    PlayerSpellMap const& spellMap = bot->GetSpellMap();
+    for (uint32 spellId : namedSpellIds)
     {
-        uint32 spellId = itr->first;
-
-        if (itr->second->State == PLAYERSPELL_REMOVED || !itr->second->Active)
+        PlayerSpellMap::const_iterator itr = spellMap.find(spellId);
+        if (itr == spellMap.end() || itr->second->State == PLAYERSPELL_REMOVED || !itr->second->Active)
             continue;
 
         SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
@@ -50,34 +57,18 @@ uint32 SpellIdValue::Calculate()
         if (spellInfo->Effects[0].Effect == SPELL_EFFECT_LEARN_SPELL)
             continue;
 
-        bool useByItem = false;
-        for (uint8 i = 0; i < 3; ++i)
-        {
-            if (spellInfo->Effects[i].Effect == SPELL_EFFECT_CREATE_ITEM &&
-                itemIds.find(spellInfo->Effects[i].ItemType) != itemIds.end())
-            {
-                useByItem = true;
-                break;
-            }
-        }
-
-        char const* spellName = spellInfo->SpellName[loc];
-        if (!useByItem && (tolower(spellName[0]) != firstSymbol || strlen(spellName) != spellLength ||
-                           !Utf8FitTo(spellName, wnamepart)))
-            continue;
-
         spellIds.insert(spellId);
     }
 
     Pet* pet = bot->GetPet();
     if (spellIds.empty() && pet)
     {
-        for (PetSpellMap::const_iterator itr = pet->m_spells.begin(); itr != pet->m_spells.end(); ++itr)
+        for (uint32 spellId : namedSpellIds)
         {
-            if (itr->second.state == PETSPELL_REMOVED)
+            PetSpellMap::const_iterator itr = pet->m_spells.find(spellId);
+            if (itr == pet->m_spells.end() || itr->second.state == PETSPELL_REMOVED)
                 continue;
 
-            uint32 spellId = itr->first;
             SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
             if (!spellInfo)
                 continue;
@@ -85,11 +76,6 @@ uint32 SpellIdValue::Calculate()
             if (spellInfo->Effects[0].Effect == SPELL_EFFECT_LEARN_SPELL)
                 continue;
 
-            char const* spellName = spellInfo->SpellName[loc];
-            if (tolower(spellName[0]) != firstSymbol || strlen(spellName) != spellLength ||
-                !Utf8FitTo(spellName, wnamepart))
-                continue;
-
             spellIds.insert(spellId);
         }
     }